@@ -22,18 +22,22 @@ target_sources(ftxui-modules
   src/ftxui/dom/canvas.cppm
   src/ftxui/dom/deprecated.cppm
   src/ftxui/dom/direction.cppm
+  src/ftxui/dom/element_arena.cppm
   src/ftxui/dom/elements.cppm
   src/ftxui/dom/flexbox_config.cppm
   src/ftxui/dom/linear_gradient.cppm
   src/ftxui/dom/node.cppm
   src/ftxui/dom/requirement.cppm
   src/ftxui/dom/selection.cppm
+  src/ftxui/dom/styled_text.cppm
   src/ftxui/dom/table.cppm
   src/ftxui/screen.cppm
   src/ftxui/screen/box.cppm
   src/ftxui/screen/color.cppm
   src/ftxui/screen/color_info.cppm
   src/ftxui/screen/deprecated.cppm
+  src/ftxui/screen/glyph_cache.cppm
+  src/ftxui/screen/glyph_index.cppm
   src/ftxui/screen/image.cppm
   src/ftxui/screen/pixel.cppm
   src/ftxui/screen/screen.cppm
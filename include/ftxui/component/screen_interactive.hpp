@@ -20,7 +20,9 @@
 
 namespace ftxui {
 class ComponentBase;
+class ElementArena;
 class Loop;
+class TerminalWriter;
 struct Event;
 
 using Component = std::shared_ptr<ComponentBase>;
@@ -40,8 +42,11 @@ class ScreenInteractive : public Screen {
   static ScreenInteractive FitComponent();
   static ScreenInteractive TerminalOutput();
 
+  ~ScreenInteractive();
+
   // Options. Must be called before Loop().
   void TrackMouse(bool enable = true);
+  void UseElementArena(bool enable = true);
 
   // Return the currently active screen, nullptr if none.
   static ScreenInteractive* Active();
@@ -138,6 +143,21 @@ class ScreenInteractive : public Screen {
 
   bool frame_valid_ = false;
 
+  // The last frame printed to the terminal. Subsequent frames only print the
+  // cells differing from it.
+  Screen front_buffer_{0, 0};
+  bool front_buffer_valid_ = false;
+
+  // The bytes written to the terminal for a frame. Reused across frames to
+  // avoid allocating.
+  std::string output_buffer_;
+
+  // Write the frames without blocking the loop. Only set while installed.
+  std::unique_ptr<TerminalWriter> terminal_writer_;
+
+  // The elements of a frame are allocated from it, when enabled.
+  std::unique_ptr<ElementArena> element_arena_;
+
   bool force_handle_ctrl_c_ = true;
   bool force_handle_ctrl_z_ = true;
 
@@ -0,0 +1,141 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_DOM_ELEMENT_ARENA_HPP
+#define FTXUI_DOM_ELEMENT_ARENA_HPP
+
+#include <cstddef>  // for size_t, byte, max_align_t
+#include <memory>   // for shared_ptr, allocate_shared, make_shared
+#include <utility>  // for forward
+
+namespace ftxui {
+
+/// @brief A memory arena the elements of a frame are allocated from.
+///
+/// A frame builds thousands of elements, and destroys them right after it is
+/// drawn. While an `ElementArena::Scope` is alive, the elements built by the
+/// current thread are allocated from the arena instead of the heap. `Release()`
+/// frees them all at once, and keeps the memory for the next frame.
+///
+/// The elements are meant to be destroyed before the arena is released. Those
+/// kept longer remain valid: `Release()` then leaves their memory to them, and
+/// the next elements are allocated from new blocks. The memory is freed with
+/// the last of them, even if the arena is destroyed first.
+///
+/// ### Example
+///
+/// ```cpp
+/// ElementArena arena;
+/// {
+///   ElementArena::Scope scope(&arena);
+///   Element document = vbox({text("Hello"), text("World")}) | border;
+///   Render(screen, document);
+/// }
+/// arena.Release();
+/// ```
+///
+/// @ingroup dom
+class ElementArena {
+  // The blocks the allocations are made from. Shared with the allocators.
+  struct Pool;
+
+ public:
+  ElementArena();
+  ~ElementArena();
+  ElementArena(const ElementArena&) = delete;
+  ElementArena& operator=(const ElementArena&) = delete;
+
+  /// @brief Allocate the elements built by the current thread from an arena,
+  /// until the scope is destroyed. A null arena allocates from the heap.
+  class Scope {
+   public:
+    explicit Scope(ElementArena* arena);
+    ~Scope();
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+   private:
+    ElementArena* previous_;
+  };
+
+  /// @brief A standard allocator allocating from an arena.
+  template <typename T>
+  class Allocator {
+   public:
+    using value_type = T;
+
+    explicit Allocator(ElementArena* arena) : pool_(arena->pool_) {}
+    template <typename U>
+    Allocator(const Allocator<U>& other)  // NOLINT
+        : pool_(other.pool_) {}
+
+    T* allocate(size_t n) {
+      // The blocks come from operator new[], which doesn't honor the
+      // alignment of over-aligned types.
+      static_assert(alignof(T) <= alignof(std::max_align_t),
+                    "over-aligned types can't be allocated from an arena");
+      return static_cast<T*>(
+          ElementArena::Allocate(*pool_, n * sizeof(T), alignof(T)));
+    }
+    void deallocate(T* pointer, size_t /*n*/) {
+      ElementArena::Deallocate(*pool_, pointer);
+    }
+
+    template <typename U>
+    bool operator==(const Allocator<U>& other) const {
+      return pool_ == other.pool_;
+    }
+    template <typename U>
+    bool operator!=(const Allocator<U>& other) const {
+      return pool_ != other.pool_;
+    }
+
+   private:
+    template <typename U>
+    friend class Allocator;
+    // Keeps the memory alive as long as an element allocated from it.
+    std::shared_ptr<Pool> pool_;
+  };
+
+  // The arena of the current thread, nullptr if none.
+  static ElementArena* Current();
+
+  // Allocate |size| bytes. |alignment| must not exceed the one of
+  // std::max_align_t. The memory is reclaimed by Release().
+  void* Allocate(size_t size, size_t alignment);
+
+  // Mark an allocation as dead. Its memory is reclaimed by Release().
+  void Deallocate(void* pointer);
+
+  // Free every allocation. The memory is reused by the next ones, unless some
+  // allocations are still alive.
+  void Release();
+
+  // The number of bytes allocated since the last Release().
+  size_t size() const;
+
+  // The number of allocations since the last Release() not deallocated yet.
+  size_t live() const;
+
+ private:
+  static void* Allocate(Pool& pool, size_t size, size_t alignment);
+  static void Deallocate(Pool& pool, void* pointer);
+
+  std::shared_ptr<Pool> pool_;
+};
+
+/// @brief Create an element. It is allocated from the arena of the current
+/// thread if any, from the heap otherwise.
+/// @ingroup dom
+template <typename T, typename... Args>
+std::shared_ptr<T> MakeElement(Args&&... args) {
+  if (ElementArena* arena = ElementArena::Current()) {
+    return std::allocate_shared<T>(ElementArena::Allocator<T>(arena),
+                                   std::forward<Args>(args)...);
+  }
+  return std::make_shared<T>(std::forward<Args>(args)...);
+}
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_ELEMENT_ARENA_HPP
@@ -6,12 +6,14 @@
 
 #include <functional>
 #include <memory>
+#include <string_view>
 
 #include "ftxui/dom/canvas.hpp"
 #include "ftxui/dom/direction.hpp"
 #include "ftxui/dom/flexbox_config.hpp"
 #include "ftxui/dom/linear_gradient.hpp"
 #include "ftxui/dom/node.hpp"
+#include "ftxui/dom/styled_text.hpp"
 #include "ftxui/screen/box.hpp"
 #include "ftxui/screen/color.hpp"
 #include "ftxui/screen/terminal.hpp"
@@ -53,6 +55,9 @@ Decorator operator|(Decorator, Decorator);
 // --- Widget ---
 Element text(std::string text);
 Element text(const std::string* text);
+Element text(const std::string* text, const size_t* generation);
+Element styledText(ConstRef<StyledText>);
+Element ansiText(std::string_view text);
 Element vtext(std::string text);
 Element separator();
 Element separatorLight();
@@ -95,6 +100,8 @@ Element paragraphAlignLeft(const std::string& text);
 Element paragraphAlignRight(const std::string& text);
 Element paragraphAlignCenter(const std::string& text);
 Element paragraphAlignJustify(const std::string& text);
+Element styledParagraph(const StyledText& text);
+Element ansiParagraph(std::string_view text);
 Element graph(GraphFunction);
 Element emptyElement();
 Element canvas(ConstRef<Canvas>);
@@ -174,6 +181,12 @@ Element yframe(Element);
 Element focus(Element);
 Element select(Element e);  // Deprecated - Alias for focus.
 
+// A list too long to be built. Only the rows visible in the frame are built by
+// the generator.
+Element virtualList(int count,
+                    int row_height,
+                    std::function<Element(int)> generator);
+
 // --- Cursor ---
 // Those are similar to `focus`, but also change the shape of the cursor.
 Element focusCursorBlock(Element);
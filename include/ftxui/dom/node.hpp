@@ -73,12 +73,40 @@ class Node {
   };
   virtual void Check(Status* status);
 
+  // Same as ComputeRequirement(), SetBox() and Check(), skipped when the
+  // element is cacheable and didn't change since the previous call. Containers
+  // call them on their children.
+  void ComputeRequirementIfDirty();
+  void SetBoxIfDirty(Box box);
+  void CheckIfDirty(Status* status);
+
+  // Mark the element as changed. Its layout, and the one of its ancestors, are
+  // computed again.
+  void Invalidate();
+
   friend void Render(Screen& screen, Node* node, Selection& selection);
 
  protected:
   Elements children_;
   Requirement requirement_;
   Box box_;
+
+  // Set by the elements whose layout only depends on their children and on
+  // their construction. Their layout is cached, as long as their children are
+  // cacheable too. They must call Invalidate() when they change. Cleared when
+  // the element is added to a second parent.
+  bool cacheable_ = false;
+
+ private:
+  // The last element this one was added to. When there were several, the
+  // element isn't cacheable anymore.
+  Node* parent_ = nullptr;
+
+  bool subtree_cacheable_ = false;
+  bool requirement_valid_ = false;
+  bool box_valid_ = false;
+  Box valid_box_;
+  Box valid_visible_;
 };
 
 void Render(Screen& screen, const Element& element);
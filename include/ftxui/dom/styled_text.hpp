@@ -0,0 +1,103 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_DOM_STYLED_TEXT_HPP
+#define FTXUI_DOM_STYLED_TEXT_HPP
+
+#include <cstddef>      // for size_t
+#include <cstdint>      // for uint32_t
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <vector>       // for vector
+
+#include "ftxui/screen/color.hpp"  // for Color
+#include "ftxui/screen/pixel.hpp"  // for Pixel
+
+namespace ftxui {
+
+/// @brief StyledText is a piece of text made of runs of different styles.
+///
+/// The runs are recorded once, when the text is built. Drawing it doesn't
+/// parse the text again. This is meant for large and heavily styled texts,
+/// like syntax highlighted buffers.
+///
+/// ### Example
+///
+/// ```cpp
+/// StyledText::Style number;
+/// number.foreground_color = Color::Red;
+/// number.bold = true;
+///
+/// StyledText code;
+/// code.Append("int", Color::Blue);
+/// code.Append(" x = ");
+/// code.Append("42", number);
+/// Element document = styledText(code);
+/// ```
+///
+/// The output of a program, colored with ANSI escape sequences, can be
+/// appended with AppendAnsi().
+///
+/// @ingroup dom
+struct StyledText {
+ public:
+  /// @brief The style of a run of text. Default colors and unset attributes
+  /// leave the style of the element unchanged.
+  struct Style {
+    Color foreground_color = Color::Default;
+    Color background_color = Color::Default;
+    bool bold = false;
+    bool dim = false;
+    bool italic = false;
+    bool underlined = false;
+    bool underlined_double = false;
+    bool blink = false;
+    bool inverted = false;
+    bool strikethrough = false;
+
+    void Apply(Pixel& pixel) const;
+    bool operator==(const Style& other) const;
+    bool operator!=(const Style& other) const { return !operator==(other); }
+  };
+
+  /// @brief A range of bytes of the text, drawn with one of the styles.
+  struct Run {
+    uint32_t offset = 0;
+    uint32_t length = 0;
+    uint32_t style = 0;  // Index in styles().
+  };
+
+  StyledText() = default;
+  explicit StyledText(std::string_view text);
+
+  StyledText& Append(std::string_view text);
+  StyledText& Append(std::string_view text, const Style& style);
+  StyledText& Append(std::string_view text, Color foreground_color);
+  StyledText& AppendAnsi(std::string_view text);
+  void Clear();
+
+  // Getters:
+  const std::string& text() const { return text_; }
+  const std::vector<Run>& runs() const { return runs_; }
+  const std::vector<Style>& styles() const { return styles_; }
+  int width() const { return width_; }
+
+ private:
+  std::string text_;
+  std::vector<Run> runs_;  // Sorted, not overlapping.
+  std::vector<Style> styles_;
+  int width_ = 0;
+
+  // The width is measured again from |measured_|, a glyph boundary near the
+  // end of the text. |measured_width_| is the width of the text before it.
+  size_t measured_ = 0;
+  int measured_width_ = 0;
+
+  // The state of AppendAnsi() between two calls:
+  Style ansi_style_;
+  std::string ansi_pending_;  // An escape sequence cut by the end of the input.
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_STYLED_TEXT_HPP
@@ -314,10 +314,14 @@ class Color {
   // clang-format on
 
   // --- Operators ------
-  bool operator==(const Color& rhs) const;
-  bool operator!=(const Color& rhs) const;
+  bool operator==(const Color& rhs) const {
+    return red_ == rhs.red_ && green_ == rhs.green_ && blue_ == rhs.blue_ &&
+           type_ == rhs.type_;
+  }
+  bool operator!=(const Color& rhs) const { return !operator==(rhs); }
 
   std::string Print(bool is_background_color) const;
+  void Print(bool is_background_color, std::string& out) const;
   bool IsOpaque() const { return alpha_ == 255; }
 
  private:
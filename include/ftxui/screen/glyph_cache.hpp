@@ -0,0 +1,55 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_SCREEN_GLYPH_CACHE_HPP
+#define FTXUI_SCREEN_GLYPH_CACHE_HPP
+
+#include <cstddef>      // for size_t
+#include <cstdint>      // for uint32_t
+#include <memory>       // for shared_ptr
+#include <string_view>  // for string_view
+#include <vector>       // for vector
+
+namespace ftxui {
+
+/// @brief The glyphs of a string, and its width.
+/// @ingroup screen
+struct GlyphLayout {
+  /// @brief A glyph, as a range of bytes of the string.
+  struct Glyph {
+    uint32_t offset = 0;
+    uint32_t size = 0;
+    int width = 0;  // 2 for fullwidth glyphs.
+  };
+
+  std::vector<Glyph> glyphs;
+  int width = 0;
+};
+
+/// @brief A process-wide LRU cache of the GlyphLayout of strings. Labels drawn
+/// on every frame are segmented only once.
+///
+/// The cache is disabled by default, and then costs a single atomic load. Long
+/// strings are never cached.
+/// @ingroup screen
+namespace GlyphCache {
+
+/// @brief The usage of the cache, since the last ResetStats().
+struct Stats {
+  size_t hits = 0;
+  size_t misses = 0;
+  size_t size = 0;      // The number of strings in the cache.
+  size_t capacity = 0;  // The maximum number of strings in the cache.
+};
+
+std::shared_ptr<const GlyphLayout> Get(std::string_view text);
+bool Enabled();
+void SetCapacity(size_t capacity);
+Stats GetStats();
+void ResetStats();
+
+}  // namespace GlyphCache
+
+}  // namespace ftxui
+
+#endif  // FTXUI_SCREEN_GLYPH_CACHE_HPP
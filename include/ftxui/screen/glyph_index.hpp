@@ -0,0 +1,68 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_SCREEN_GLYPH_INDEX_HPP
+#define FTXUI_SCREEN_GLYPH_INDEX_HPP
+
+#include <cstddef>      // for size_t
+#include <string_view>  // for string_view
+#include <vector>       // for vector
+
+namespace ftxui {
+
+/// @brief An index of the glyphs of a UTF8 string. It converts between bytes,
+/// glyphs and cells in O(log n).
+///
+/// After a local edit of the string, Update() segments again only the glyphs
+/// around the edit.
+///
+/// ### Example
+///
+/// ```cpp
+/// std::string text = "a测b";
+/// GlyphIndex index(text);
+/// index.GlyphToCell(2);  // 3
+///
+/// text.insert(1, "x");
+/// index.Update(text, 1, 0, 1);
+/// ```
+///
+/// @ingroup screen
+class GlyphIndex {
+ public:
+  GlyphIndex() = default;
+  explicit GlyphIndex(std::string_view text);
+
+  void Reset(std::string_view text);
+  void Update(std::string_view text,
+              size_t position,
+              size_t removed,
+              size_t inserted);
+
+  // The number of glyphs, and of cells they take.
+  size_t size() const { return bytes_.size() - 1; }
+  int width() const { return cells_.back(); }
+
+  // Where the |glyph| starts. The end of the text for size().
+  size_t GlyphToByte(size_t glyph) const;
+  int GlyphToCell(size_t glyph) const;
+  int GlyphWidth(size_t glyph) const;
+
+  // The first glyph starting at or after |byte| or |cell|. size() if none.
+  size_t ByteToGlyph(size_t byte) const;
+  size_t CellToGlyph(int cell) const;
+
+  // Same as GlyphNext() and GlyphPrevious(): the start of the next or of the
+  // previous glyph.
+  size_t Next(size_t byte) const;
+  size_t Previous(size_t byte) const;
+
+ private:
+  // For every glyph, followed by the end of the text:
+  std::vector<size_t> bytes_ = {0};  // Where it starts.
+  std::vector<int> cells_ = {0};     // Its first cell.
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_SCREEN_GLYPH_INDEX_HPP
@@ -8,10 +8,31 @@
 #include <vector>  // for vector
 
 #include "ftxui/screen/box.hpp"    // for Box
-#include "ftxui/screen/pixel.hpp"  // for Pixel
+#include "ftxui/screen/pixel.hpp"  // for Pixel, Grapheme
 
 namespace ftxui {
 
+/// @brief A view over a contiguous sequence of elements, like a row of an
+/// Image.
+/// @ingroup screen
+template <typename T>
+class Span {
+ public:
+  Span() = default;
+  Span(T* data, int size) : data_(data), size_(size) {}
+
+  T* begin() const { return data_; }
+  T* end() const { return data_ + size_; }  // NOLINT
+  T* data() const { return data_; }
+  int size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+  T& operator[](int index) const { return data_[index]; }  // NOLINT
+
+ private:
+  T* data_ = nullptr;
+  int size_ = 0;
+};
+
 /// @brief A rectangular grid of Pixel.
 /// @ingroup screen
 class Image {
@@ -21,13 +42,21 @@ class Image {
   Image(int dimx, int dimy);
 
   // Access a character in the grid at a given position.
-  std::string& at(int x, int y);
-  const std::string& at(int x, int y) const;
+  Grapheme& at(int x, int y);
+  const Grapheme& at(int x, int y) const;
 
   // Access a cell (Pixel) in the grid at a given position.
   Pixel& PixelAt(int x, int y);
   const Pixel& PixelAt(int x, int y) const;
 
+  // Access a row of pixels. Rows are stored contiguously, one after the other.
+  Span<Pixel> Row(int y);
+  Span<const Pixel> Row(int y) const;
+
+  // Access the pixels of a row in between |x_min| and |x_max| included. Only
+  // the ones inside the stencil are returned.
+  Span<Pixel> Row(int y, int x_min, int x_max);
+
   // Get screen dimensions.
   int dimx() const { return dimx_; }
   int dimy() const { return dimy_; }
@@ -35,12 +64,16 @@ class Image {
   // Fill the image with space and default style
   void Clear();
 
+  // Change the dimensions. The content is cleared. The memory is reused when
+  // possible.
+  void Resize(int dimx, int dimy);
+
   Box stencil;
 
  protected:
   int dimx_;
   int dimy_;
-  std::vector<std::vector<Pixel>> pixels_;
+  std::vector<Pixel> pixels_;  // Row-major, dimx_ * dimy_ pixels.
 };
 
 }  // namespace ftxui
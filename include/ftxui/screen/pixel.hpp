@@ -4,12 +4,152 @@
 #ifndef FTXUI_SCREEN_PIXEL_HPP
 #define FTXUI_SCREEN_PIXEL_HPP
 
-#include <cstdint>                 // for uint8_t
+#include <cstddef>                 // for size_t
+#include <cstdint>                 // for uint8_t, uint16_t
+#include <cstring>                 // for memcmp, memcpy, memset
+#include <iosfwd>                  // for ostream
 #include <string>                  // for string, basic_string, allocator
+#include <string_view>             // for string_view
+#include <type_traits>             // for enable_if_t, is_convertible_v
 #include "ftxui/screen/color.hpp"  // for Color, Color::Default
 
 namespace ftxui {
 
+/// @brief The UTF8 encoded grapheme drawn by a Pixel.
+///
+/// Short graphemes are stored inline. The longer ones, like flags or sequences
+/// of combining characters, are interned into a process-wide table and
+/// referenced by their index. This keeps Pixel small. An interned grapheme is
+/// freed with the last Grapheme referring to it.
+///
+/// The width of the grapheme is computed once, when it is assigned.
+/// @ingroup screen
+class Grapheme {
+ public:
+  // NOLINTBEGIN
+  Grapheme() = default;
+  Grapheme(std::string_view value);
+  Grapheme(const std::string& value) : Grapheme(std::string_view(value)) {}
+  Grapheme(const char* value) : Grapheme(std::string_view(value)) {}
+  operator std::string() const { return std::string(view()); }
+  // NOLINTEND
+
+  Grapheme(const Grapheme& other) : info_(other.info_) {
+    std::memcpy(data_, other.data_, kInlineCapacity);  // NOLINT
+    if (InlineSize() == kInterned) {
+      Reference();
+    }
+  }
+  Grapheme(Grapheme&& other) noexcept : info_(other.info_) {
+    std::memcpy(data_, other.data_, kInlineCapacity);  // NOLINT
+    other.Reset();
+  }
+  Grapheme& operator=(const Grapheme& other) {
+    if (other.InlineSize() == kInterned) {
+      other.Reference();
+    }
+    if (InlineSize() == kInterned) {
+      Unreference();
+    }
+    std::memcpy(data_, other.data_, kInlineCapacity);  // NOLINT
+    info_ = other.info_;
+    return *this;
+  }
+  Grapheme& operator=(Grapheme&& other) noexcept {
+    if (this != &other) {
+      if (InlineSize() == kInterned) {
+        Unreference();
+      }
+      std::memcpy(data_, other.data_, kInlineCapacity);  // NOLINT
+      info_ = other.info_;
+      other.Reset();
+    }
+    return *this;
+  }
+  ~Grapheme() {
+    if (InlineSize() == kInterned) {
+      Unreference();
+    }
+  }
+
+  // The view is valid as long as the Grapheme.
+  std::string_view view() const {
+    if (InlineSize() != kInterned) {
+      return {data_, InlineSize()};  // NOLINT
+    }
+    return Interned();
+  }
+
+  bool empty() const { return InlineSize() == 0; }
+  size_t size() const {
+    return InlineSize() != kInterned ? InlineSize() : Interned().size();
+  }
+  char operator[](size_t index) const { return view()[index]; }
+
+  // The number of cells drawn by the grapheme. Values above 3 are reported as
+  // 3.
+  int width() const { return info_ >> kWidthShift; }
+
+  bool operator==(const Grapheme& other) const {
+    if (info_ != other.info_) {
+      return false;
+    }
+    // Equal interned graphemes usually share their entry, but not always.
+    return std::memcmp(data_, other.data_, kInlineCapacity) == 0 ||
+           (InlineSize() == kInterned && view() == other.view());
+  }
+  bool operator!=(const Grapheme& other) const { return !operator==(other); }
+
+  // Compare with any string-like value.
+  template <typename T,
+            typename = std::enable_if_t<
+                std::is_convertible_v<const T&, std::string_view>>>
+  friend bool operator==(const Grapheme& a, const T& b) {
+    return a.view() == std::string_view(b);
+  }
+  template <typename T,
+            typename = std::enable_if_t<
+                std::is_convertible_v<const T&, std::string_view>>>
+  friend bool operator==(const T& a, const Grapheme& b) {
+    return b.view() == std::string_view(a);
+  }
+  template <typename T,
+            typename = std::enable_if_t<
+                std::is_convertible_v<const T&, std::string_view>>>
+  friend bool operator!=(const Grapheme& a, const T& b) {
+    return a.view() != std::string_view(b);
+  }
+  template <typename T,
+            typename = std::enable_if_t<
+                std::is_convertible_v<const T&, std::string_view>>>
+  friend bool operator!=(const T& a, const Grapheme& b) {
+    return b.view() != std::string_view(a);
+  }
+
+ private:
+  static constexpr size_t kInlineCapacity = 7;
+  static constexpr uint8_t kSizeMask = 0x0F;
+  static constexpr uint8_t kInterned = 0x0F;
+  static constexpr int kWidthShift = 4;
+
+  uint8_t InlineSize() const { return info_ & kSizeMask; }
+  std::string_view Interned() const;
+  void Reference() const;
+  void Unreference() const;
+  void Reset() {
+    std::memset(data_, 0, kInlineCapacity);  // NOLINT
+    info_ = 0;
+  }
+
+  // Either the bytes of the grapheme, or the slot of the interned one.
+  char data_[kInlineCapacity] = {};  // NOLINT
+
+  // The low bits store the size, or kInterned. The high bits store the width.
+  uint8_t info_ = 0;
+};
+
+std::ostream& operator<<(std::ostream& out, const Grapheme& grapheme);
+
 /// @brief A Unicode character and its associated style.
 /// @ingroup screen
 struct Pixel {
@@ -38,15 +178,28 @@ struct Pixel {
   // The hyperlink associated with the pixel.
   // 0 is the default value, meaning no hyperlink.
   // It's an index for accessing Screen meta data
-  uint8_t hyperlink = 0;
+  uint16_t hyperlink = 0;
 
   // The graphemes stored into the pixel. To support combining characters,
   // like: a?, this can potentially contain multiple codepoints.
-  std::string character = "";
+  Grapheme character;
 
   // Colors:
   Color background_color = Color::Default;
   Color foreground_color = Color::Default;
+
+  bool operator==(const Pixel& other) const {
+    return blink == other.blink && bold == other.bold && dim == other.dim &&
+           italic == other.italic && inverted == other.inverted &&
+           underlined == other.underlined &&
+           underlined_double == other.underlined_double &&
+           strikethrough == other.strikethrough &&
+           automerge == other.automerge && hyperlink == other.hyperlink &&
+           character == other.character &&
+           background_color == other.background_color &&
+           foreground_color == other.foreground_color;
+  }
+  bool operator!=(const Pixel& other) const { return !operator==(other); }
 };
 
 }  // namespace ftxui
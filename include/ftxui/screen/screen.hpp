@@ -4,10 +4,11 @@
 #ifndef FTXUI_SCREEN_SCREEN_HPP
 #define FTXUI_SCREEN_SCREEN_HPP
 
-#include <cstdint>     // for uint8_t
-#include <functional>  // for function
-#include <string>      // for string, basic_string, allocator
-#include <vector>      // for vector
+#include <cstdint>        // for uint16_t, uint64_t
+#include <functional>     // for function
+#include <string>         // for string, basic_string, allocator
+#include <unordered_map>  // for unordered_map
+#include <vector>         // for vector
 
 #include "ftxui/screen/image.hpp"     // for Pixel, Image
 #include "ftxui/screen/terminal.hpp"  // for Dimensions
@@ -33,6 +34,15 @@ class Screen : public Image {
 
   std::string ToString() const;
 
+  // Produce the output updating a terminal displaying |previous| into this
+  // screen. Only the cells that changed are printed.
+  std::string ToString(const Screen& previous) const;
+
+  // Same as above, appending to |out|. Reusing |out| across frames avoids
+  // allocating.
+  void ToString(std::string& out) const;
+  void ToString(const Screen& previous, std::string& out) const;
+
   // Print the Screen on to the terminal.
   void Print() const;
 
@@ -43,7 +53,13 @@ class Screen : public Image {
   // Move the terminal cursor n-lines up with n = dimy().
   std::string ResetPosition(bool clear = false) const;
 
+  // Merge the box drawing characters of the pixels with Pixel::automerge set.
+  // Renderers setting it must call MarkAutomerge() for the row.
   void ApplyShader();
+  void MarkAutomerge(int y);
+
+  // Exchange the pixels and dimensions with another screen.
+  void Swap(Screen& other);
 
   struct Cursor {
     int x = 0;
@@ -65,9 +81,10 @@ class Screen : public Image {
   void SetCursor(Cursor cursor) { cursor_ = cursor; }
 
   // Store an hyperlink in the screen. Return the id of the hyperlink. The id is
-  // used to identify the hyperlink when the user click on it.
-  uint8_t RegisterHyperlink(const std::string& link);
-  const std::string& Hyperlink(uint8_t id) const;
+  // used to identify the hyperlink when the user click on it. Hyperlinks are
+  // kept by Clear(), so that a link keeps its id from one frame to the next.
+  uint16_t RegisterHyperlink(const std::string& link);
+  const std::string& Hyperlink(uint16_t id) const;
 
   using SelectionStyle = std::function<void(Pixel&)>;
   const SelectionStyle& GetSelectionStyle() const;
@@ -75,7 +92,33 @@ class Screen : public Image {
 
  protected:
   Cursor cursor_;
+
+  // The registered hyperlinks, and the id of each of them.
   std::vector<std::string> hyperlinks_ = {""};
+  std::unordered_map<std::string, uint16_t> hyperlink_ids_;
+
+  // Identify a hyperlink registry. A copy gets a new identity, because the two
+  // registries evolve independently afterward.
+  class HyperlinkRegistryId {
+   public:
+    HyperlinkRegistryId();
+    HyperlinkRegistryId(const HyperlinkRegistryId&);
+    HyperlinkRegistryId& operator=(const HyperlinkRegistryId&);
+    ~HyperlinkRegistryId() = default;
+    uint64_t value() const { return value_; }
+
+   private:
+    uint64_t value_;
+  };
+
+  // The registry of this screen, and the one that issued the hyperlink ids of
+  // the pixels. They differ after Swap(), which exchanges the pixels but keeps
+  // the registries. 0 means the pixels mix ids from several registries.
+  HyperlinkRegistryId hyperlinks_id_;
+  uint64_t pixels_hyperlinks_id_ = hyperlinks_id_.value();
+
+  // The rows containing pixels to be merged by ApplyShader().
+  std::vector<bool> automerge_rows_;
 
   // The current selection style. This is overridden by various dom elements.
   SelectionStyle selection_style_ = [](Pixel& pixel) {
@@ -4,8 +4,11 @@
 #ifndef FTXUI_SCREEN_STRING_HPP
 #define FTXUI_SCREEN_STRING_HPP
 
-#include <string>   // for string, wstring, to_string
-#include <vector>   // for vector
+#include <cstddef>      // for size_t, ptrdiff_t
+#include <iterator>     // for forward_iterator_tag
+#include <string>       // for string, wstring, to_string
+#include <string_view>  // for string_view
+#include <vector>       // for vector
 
 namespace ftxui {
 
@@ -21,6 +24,71 @@ std::wstring to_wstring(T s) {
 
 int string_width(const std::string&);
 
+// A glyph of a UTF8 string, and the number of cells it takes.
+struct Glyph {
+  std::string_view value;
+  int width = 0;  // 2 for fullwidth glyphs.
+};
+
+// Iterate over the glyphs of a UTF8 string, without copying them. Glyphs are
+// the extended grapheme clusters of UAX #29: combining characters, emoji
+// sequences, flags and Hangul syllables form a single glyph. Control
+// characters are skipped.
+class GlyphIterator {
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = Glyph;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const Glyph*;
+  using reference = const Glyph&;
+
+  GlyphIterator() = default;
+  GlyphIterator(std::string_view input, size_t start);
+
+  const Glyph& operator*() const { return glyph_; }
+  const Glyph* operator->() const { return &glyph_; }
+  GlyphIterator& operator++();
+  GlyphIterator operator++(int);
+
+  bool operator==(const GlyphIterator& other) const {
+    return start_ == other.start_;
+  }
+  bool operator!=(const GlyphIterator& other) const {
+    return start_ != other.start_;
+  }
+
+  // The position of the current glyph in the input.
+  size_t position() const { return start_; }
+
+ private:
+  void Read(size_t start);
+
+  std::string_view input_;
+  size_t start_ = 0;
+  Glyph glyph_;
+};
+
+// The glyphs of |input|, to be used in range-based for loops:
+//
+// for (const Glyph& glyph : Glyphs(input)) {
+//   ...
+// }
+//
+// |input| must outlive the range.
+class GlyphRange {
+ public:
+  explicit GlyphRange(std::string_view input) : input_(input) {}
+  GlyphIterator begin() const { return {input_, 0}; }
+  GlyphIterator end() const { return {input_, input_.size()}; }
+
+ private:
+  std::string_view input_;
+};
+
+inline GlyphRange Glyphs(std::string_view input) {
+  return GlyphRange(input);
+}
+
 // Split the string into a its glyphs. An empty one is inserted ater fullwidth
 // ones.
 std::vector<std::string> Utf8ToGlyphs(const std::string& input);
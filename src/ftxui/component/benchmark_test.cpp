@@ -0,0 +1,102 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <benchmark/benchmark.h>
+#include <iostream>     // for cout, endl
+#include <string>       // for string
+#include <string_view>  // for string_view, operator==
+#include <vector>       // for vector
+
+#include "ftxui/component/component.hpp"  // for Button, Checkbox, Input, Renderer, Container
+#include "ftxui/dom/elements.hpp"  // for text, border, separator, gauge, spinner, vbox, hbox
+#include "ftxui/dom/node.hpp"       // for Render
+#include "ftxui/dom/table.hpp"      // for Table
+#include "ftxui/screen/screen.hpp"  // for Screen, Dimension
+
+#if !defined(_WIN32)
+#include <fcntl.h>     // for O_WRONLY
+#include <spawn.h>     // for posix_spawn, posix_spawn_file_actions_t
+#include <sys/wait.h>  // for waitpid
+
+extern char** environ;  // NOLINT
+#endif
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+
+constexpr std::string_view kFirstFrameFlag = "--ftxui_first_frame";
+const char* g_program = nullptr;
+
+// What a short-lived tool does before its first frame: build a few components,
+// render them once and print the result.
+void FirstFrame() {
+  std::string name;
+  bool checked = false;
+  auto layout = Container::Vertical({
+      Input(&name, "name"),
+      Checkbox("checked", &checked),
+      Button("Quit", [] {}),
+  });
+  auto component = Renderer(layout, [&] {
+    auto table = Table({{"Key", "Value"}, {"name", name}});
+    table.SelectAll().Border(LIGHT);
+    return vbox({
+               text("Startup"),
+               separator(),
+               hbox({layout->Render(), separator(), table.Render()}),
+               gauge(0.5f),
+               spinner(5, 0),
+           }) |
+           border;
+  });
+  auto screen = Screen::Create(Dimension::Fixed(80), Dimension::Fixed(24));
+  Render(screen, component->Render());
+  std::cout << screen.ToString() << std::endl;
+}
+
+#if !defined(_WIN32)
+// The time-to-first-frame of a new process. This includes loading the program
+// and initializing its static tables.
+static void BenchmarkStartup(benchmark::State& state) {
+  posix_spawn_file_actions_t actions;
+  posix_spawn_file_actions_init(&actions);
+  posix_spawn_file_actions_addopen(&actions, 1, "/dev/null", O_WRONLY, 0);
+  std::string program = g_program;
+  std::string flag(kFirstFrameFlag);
+  std::vector<char*> argv = {program.data(), flag.data(), nullptr};
+  while (state.KeepRunning()) {
+    pid_t pid = 0;
+    if (posix_spawn(&pid, program.c_str(), &actions, nullptr, argv.data(),
+                    environ) != 0) {
+      state.SkipWithError("posix_spawn failed");
+      break;
+    }
+    int status = 0;
+    waitpid(pid, &status, 0);
+  }
+  posix_spawn_file_actions_destroy(&actions);
+}
+BENCHMARK(BenchmarkStartup)->Unit(benchmark::kMillisecond)->UseRealTime();
+#endif
+
+}  // namespace
+
+}  // namespace ftxui
+
+int main(int argc, char** argv) {
+  if (argc == 2 && argv[1] == ftxui::kFirstFrameFlag) {
+    ftxui::FirstFrame();
+    return 0;
+  }
+  ftxui::g_program = argv[0];
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
+// NOLINTEND
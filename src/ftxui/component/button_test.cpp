@@ -126,22 +126,22 @@ TEST(ButtonTest, Animation) {
     Screen screen(12, 3);
     Render(screen, container->Render());
     EXPECT_EQ(screen.ToString(),
-              "\x1B[1m\x1B[38;2;191;191;191m\x1B[48;2;0;0;0m      \x1B[22m     "
-              " \x1B[39m\x1B[49m\r\n\x1B[1m\x1B[38;2;191;191;191m\x1B[48;2;0;0;"
-              "0m btn1 \x1B[22m btn2 "
-              "\x1B[39m\x1B[49m\r\n\x1B[1m\x1B[38;2;191;191;191m\x1B[48;2;0;0;"
-              "0m      \x1B[22m      \x1B[39m\x1B[49m");
+              "\x1B[1;38;2;191;191;191;48;2;0;0;0m      \x1B[22m      "
+              "\x1B[39;49m\r\n\x1B[1;38;2;191;191;191;48;2;0;0;0m btn1 "
+              "\x1B[22m btn2 \x1B[39;49m\r\n"
+              "\x1B[1;38;2;191;191;191;48;2;0;0;0m      \x1B[22m      "
+              "\x1B[39;49m");
   }
   selected = 1;
   {
     Screen screen(12, 3);
     Render(screen, container->Render());
     EXPECT_EQ(screen.ToString(),
-              "\x1B[38;2;191;191;191m\x1B[48;2;0;0;0m      \x1B[1m      "
-              "\x1B[22m\x1B[39m\x1B[49m\r\n\x1B[38;2;191;191;191m\x1B[48;2;0;0;"
-              "0m btn1 \x1B[1m btn2 "
-              "\x1B[22m\x1B[39m\x1B[49m\r\n\x1B[38;2;191;191;191m\x1B[48;2;0;0;"
-              "0m      \x1B[1m      \x1B[22m\x1B[39m\x1B[49m");
+              "\x1B[38;2;191;191;191;48;2;0;0;0m      \x1B[1m      "
+              "\x1B[22;39;49m\r\n\x1B[38;2;191;191;191;48;2;0;0;0m btn1 "
+              "\x1B[1m btn2 \x1B[22;39;49m\r\n"
+              "\x1B[38;2;191;191;191;48;2;0;0;0m      \x1B[1m      "
+              "\x1B[22;39;49m");
   }
   animation::Params params(2s);
   container->OnAnimation(params);
@@ -150,13 +150,12 @@ TEST(ButtonTest, Animation) {
     Render(screen, container->Render());
     EXPECT_EQ(
         screen.ToString(),
-        "\x1B[38;2;191;191;191m\x1B[48;2;0;0;0m      "
-        "\x1B[1m\x1B[38;2;254;254;254m\x1B[48;2;127;127;127m      "
-        "\x1B[22m\x1B[39m\x1B[49m\r\n\x1B[38;2;191;191;191m\x1B[48;2;0;0;0m "
-        "btn1 \x1B[1m\x1B[38;2;254;254;254m\x1B[48;2;127;127;127m btn2 "
-        "\x1B[22m\x1B[39m\x1B[49m\r\n\x1B[38;2;191;191;191m\x1B[48;2;0;0;0m    "
-        "  \x1B[1m\x1B[38;2;254;254;254m\x1B[48;2;127;127;127m      "
-        "\x1B[22m\x1B[39m\x1B[49m");
+        "\x1B[38;2;191;191;191;48;2;0;0;0m      "
+        "\x1B[1;38;2;254;254;254;48;2;127;127;127m      \x1B[22;39;49m\r\n"
+        "\x1B[38;2;191;191;191;48;2;0;0;0m btn1 "
+        "\x1B[1;38;2;254;254;254;48;2;127;127;127m btn2 \x1B[22;39;49m\r\n"
+        "\x1B[38;2;191;191;191;48;2;0;0;0m      "
+        "\x1B[1;38;2;254;254;254;48;2;127;127;127m      \x1B[22;39;49m");
   }
   EXPECT_EQ(selected, 1);
   container->OnEvent(MousePressed(3, 1));
@@ -166,13 +165,12 @@ TEST(ButtonTest, Animation) {
     Render(screen, container->Render());
     EXPECT_EQ(
         screen.ToString(),
-        "\x1B[1m\x1B[38;2;226;226;226m\x1B[48;2;93;93;93m      "
-        "\x1B[22m\x1B[38;2;254;254;254m\x1B[48;2;127;127;127m      "
-        "\x1B[39m\x1B[49m\r\n\x1B[1m\x1B[38;2;226;226;226m\x1B[48;2;93;93;93m "
-        "btn1 \x1B[22m\x1B[38;2;254;254;254m\x1B[48;2;127;127;127m btn2 "
-        "\x1B[39m\x1B[49m\r\n\x1B[1m\x1B[38;2;226;226;226m\x1B[48;2;93;93;93m  "
-        "    \x1B[22m\x1B[38;2;254;254;254m\x1B[48;2;127;127;127m      "
-        "\x1B[39m\x1B[49m");
+        "\x1B[1;38;2;226;226;226;48;2;93;93;93m      "
+        "\x1B[22;38;2;254;254;254;48;2;127;127;127m      \x1B[39;49m\r\n"
+        "\x1B[1;38;2;226;226;226;48;2;93;93;93m btn1 "
+        "\x1B[22;38;2;254;254;254;48;2;127;127;127m btn2 \x1B[39;49m\r\n"
+        "\x1B[1;38;2;226;226;226;48;2;93;93;93m      "
+        "\x1B[22;38;2;254;254;254;48;2;127;127;127m      \x1B[39;49m");
   }
   container->OnAnimation(params);
   {
@@ -180,13 +178,12 @@ TEST(ButtonTest, Animation) {
     Render(screen, container->Render());
     EXPECT_EQ(
         screen.ToString(),
-        "\x1B[1m\x1B[38;2;254;254;254m\x1B[48;2;127;127;127m      "
-        "\x1B[22m\x1B[38;2;191;191;191m\x1B[48;2;0;0;0m      "
-        "\x1B[39m\x1B[49m\r\n\x1B[1m\x1B[38;2;254;254;254m\x1B[48;2;127;127;"
-        "127m btn1 \x1B[22m\x1B[38;2;191;191;191m\x1B[48;2;0;0;0m btn2 "
-        "\x1B[39m\x1B[49m\r\n\x1B[1m\x1B[38;2;254;254;254m\x1B[48;2;127;127;"
-        "127m      \x1B[22m\x1B[38;2;191;191;191m\x1B[48;2;0;0;0m      "
-        "\x1B[39m\x1B[49m");
+        "\x1B[1;38;2;254;254;254;48;2;127;127;127m      "
+        "\x1B[22;38;2;191;191;191;48;2;0;0;0m      \x1B[39;49m\r\n"
+        "\x1B[1;38;2;254;254;254;48;2;127;127;127m btn1 "
+        "\x1B[22;38;2;191;191;191;48;2;0;0;0m btn2 \x1B[39;49m\r\n"
+        "\x1B[1;38;2;254;254;254;48;2;127;127;127m      "
+        "\x1B[22;38;2;191;191;191;48;2;0;0;0m      \x1B[39;49m");
   }
 }
 
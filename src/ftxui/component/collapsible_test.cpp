@@ -26,7 +26,7 @@ TEST(CollapsibleTest, Basic) {
     Screen screen(8, 3);
     Render(screen, collapsible->Render());
     EXPECT_EQ(screen.ToString(),
-              "\xE2\x96\xB6 \x1B[1m\x1B[7mparent\x1B[22m\x1B[27m\r\n"
+              "\xE2\x96\xB6 \x1B[1;7mparent\x1B[22;27m\r\n"
               "        \r\n"
               "        ");
   }
@@ -38,7 +38,7 @@ TEST(CollapsibleTest, Basic) {
     Screen screen(8, 3);
     Render(screen, collapsible->Render());
     EXPECT_EQ(screen.ToString(),
-              "\xE2\x96\xBC \x1B[1m\x1B[7mparent\x1B[22m\x1B[27m\r\n"
+              "\xE2\x96\xBC \x1B[1;7mparent\x1B[22;27m\r\n"
               "child   \r\n"
               "        ");
   }
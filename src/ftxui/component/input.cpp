@@ -18,8 +18,8 @@
 #include "ftxui/component/screen_interactive.hpp"  // for Component
 #include "ftxui/dom/elements.hpp"  // for operator|, reflect, text, Element, xflex, hbox, Elements, frame, operator|=, vbox, focus, focusCursorBarBlinking, select
 #include "ftxui/screen/box.hpp"    // for Box
-#include "ftxui/screen/string.hpp"           // for string_width
-#include "ftxui/screen/string_internal.hpp"  // for GlyphNext, GlyphPrevious, WordBreakProperty, EatCodePoint, CodepointToWordBreakProperty, IsFullWidth, WordBreakProperty::ALetter, WordBreakProperty::CR, WordBreakProperty::Double_Quote, WordBreakProperty::Extend, WordBreakProperty::ExtendNumLet, WordBreakProperty::Format, WordBreakProperty::Hebrew_Letter, WordBreakProperty::Katakana, WordBreakProperty::LF, WordBreakProperty::MidLetter, WordBreakProperty::MidNum, WordBreakProperty::MidNumLet, WordBreakProperty::Newline, WordBreakProperty::Numeric, WordBreakProperty::Regional_Indicator, WordBreakProperty::Single_Quote, WordBreakProperty::WSegSpace, WordBreakProperty::ZWJ
+#include "ftxui/screen/glyph_index.hpp"      // for GlyphIndex
+#include "ftxui/screen/string_internal.hpp"  // for GlyphNext, WordBreakProperty, EatCodePoint, CodepointToWordBreakProperty, WordBreakProperty::ALetter, WordBreakProperty::CR, WordBreakProperty::Double_Quote, WordBreakProperty::Extend, WordBreakProperty::ExtendNumLet, WordBreakProperty::Format, WordBreakProperty::Hebrew_Letter, WordBreakProperty::Katakana, WordBreakProperty::LF, WordBreakProperty::MidLetter, WordBreakProperty::MidNum, WordBreakProperty::MidNumLet, WordBreakProperty::Newline, WordBreakProperty::Numeric, WordBreakProperty::Regional_Indicator, WordBreakProperty::Single_Quote, WordBreakProperty::WSegSpace, WordBreakProperty::ZWJ
 #include "ftxui/screen/util.hpp"             // for clamp
 #include "ftxui/util/ref.hpp"                // for StringRef, Ref
 
@@ -40,17 +40,6 @@ std::vector<std::string> Split(const std::string& input) {
   return output;
 }
 
-size_t GlyphWidth(const std::string& input, size_t iter) {
-  uint32_t ucs = 0;
-  if (!EatCodePoint(input, iter, &iter, &ucs)) {
-    return 0;
-  }
-  if (IsFullWidth(ucs)) {
-    return 2;
-  }
-  return 1;
-}
-
 bool IsWordCodePoint(uint32_t codepoint) {
   switch (CodepointToWordBreakProperty(codepoint)) {
     case WordBreakProperty::ALetter:
@@ -111,6 +100,7 @@ class InputBase : public ComponentBase, public InputOption {
              focus | reflect(box_);
     }
 
+    IndexContent(/*compare_bytes=*/true);
     Elements elements;
     const std::vector<std::string> lines = Split(*content);
 
@@ -189,13 +179,67 @@ class InputBase : public ComponentBase, public InputOption {
     return text(out);
   }
 
+  // Index the glyphs of the content. The edits made by the input update the
+  // index. A content modified from the outside is indexed again. Its size is
+  // checked on every event, and its bytes only on render, like Split().
+  void IndexContent(bool compare_bytes) {
+    if (indexed_content_.size() != content().size() ||
+        (compare_bytes && indexed_content_ != content())) {
+      indexed_content_ = content();
+      index_.Reset(indexed_content_);
+    }
+  }
+
+  void Insert(size_t position, const std::string& text) {
+    content->insert(position, text);
+    indexed_content_.insert(position, text);
+    index_.Update(content(), position, 0, text.size());
+  }
+
+  void Erase(size_t position, size_t size) {
+    content->erase(position, size);
+    indexed_content_.erase(position, size);
+    index_.Update(content(), position, size, 0);
+  }
+
+  // The start of the line containing |position|.
+  size_t LineStart(size_t position) const {
+    if (position == 0) {
+      return 0;
+    }
+    const size_t newline = content().rfind('\n', position - 1);
+    return newline == std::string::npos ? 0 : newline + 1;
+  }
+
+  // The end of the line containing |position|, before its newline.
+  size_t LineEnd(size_t position) const {
+    const size_t newline = content().find('\n', position);
+    return newline == std::string::npos ? content().size() : newline;
+  }
+
+  // The number of cells between the start of the line and |position|.
+  int Column(size_t line_start, size_t position) const {
+    return index_.GlyphToCell(index_.ByteToGlyph(position)) -
+           index_.GlyphToCell(index_.ByteToGlyph(line_start));
+  }
+
+  // The start of the first glyph at least |columns| cells after |line_start|,
+  // or the end of the line.
+  size_t ColumnToPosition(size_t line_start, int columns) const {
+    const size_t first = index_.ByteToGlyph(line_start);
+    const size_t last = index_.ByteToGlyph(LineEnd(line_start));
+    const size_t glyph =
+        index_.CellToGlyph(index_.GlyphToCell(first) + std::max(columns, 0));
+    return index_.GlyphToByte(util::clamp(glyph, first, last));
+  }
+
   bool HandleBackspace() {
     if (cursor_position() == 0) {
       return false;
     }
-    const size_t start = GlyphPrevious(content(), cursor_position());
+    const size_t start = index_.Previous(cursor_position());
     const size_t end = cursor_position();
-    content->erase(start, end - start);
+    Erase(start, end - start);
     cursor_position() = static_cast<int>(start);
     on_change();
     return true;
@@ -206,8 +250,8 @@ class InputBase : public ComponentBase, public InputOption {
       return false;
     }
     const size_t start = cursor_position();
-    const size_t end = GlyphNext(content(), cursor_position());
-    content->erase(start, end - start);
+    const size_t end = index_.Next(cursor_position());
+    Erase(start, end - start);
     return true;
   }
 
@@ -224,8 +268,7 @@ class InputBase : public ComponentBase, public InputOption {
       return false;
     }
 
-    cursor_position() =
-        static_cast<int>(GlyphPrevious(content(), cursor_position()));
+    cursor_position() = static_cast<int>(index_.Previous(cursor_position()));
     return true;
   }
 
@@ -234,73 +277,24 @@ class InputBase : public ComponentBase, public InputOption {
       return false;
     }
 
-    cursor_position() =
-        static_cast<int>(GlyphNext(content(), cursor_position()));
+    cursor_position() = static_cast<int>(index_.Next(cursor_position()));
     return true;
   }
 
-  size_t CursorColumn() {
-    size_t iter = cursor_position();
-    int width = 0;
-    while (true) {
-      if (iter == 0) {
-        break;
-      }
-      iter = GlyphPrevious(content(), iter);
-      if (content()[iter] == '\n') {
-        break;
-      }
-      width += static_cast<int>(GlyphWidth(content(), iter));
-    }
-    return width;
-  }
-
-  // Move the cursor `columns` on the right, if possible.
-  void MoveCursorColumn(int columns) {
-    while (columns > 0) {
-      if (cursor_position() == (int)content().size() ||
-          content()[cursor_position()] == '\n') {
-        return;
-      }
-
-      columns -= static_cast<int>(GlyphWidth(content(), cursor_position()));
-      cursor_position() =
-          static_cast<int>(GlyphNext(content(), cursor_position()));
-    }
-  }
-
   bool HandleArrowUp() {
     if (cursor_position() == 0 or not multiline()) {
       return false;
     }
 
-    const size_t columns = CursorColumn();
-
-    // Move cursor at the beginning of 2 lines above.
-    while (true) {
-      if (cursor_position() == 0) {
-        return true;
-      }
-      const size_t previous = GlyphPrevious(content(), cursor_position());
-      if (content()[previous] == '\n') {
-        break;
-      }
-      cursor_position() = static_cast<int>(previous);
-    }
-    cursor_position() =
-        static_cast<int>(GlyphPrevious(content(), cursor_position()));
-    while (true) {
-      if (cursor_position() == 0) {
-        break;
-      }
-      const size_t previous = GlyphPrevious(content(), cursor_position());
-      if (content()[previous] == '\n') {
-        break;
-      }
-      cursor_position() = static_cast<int>(previous);
+    const size_t line_start = LineStart(cursor_position());
+    const int columns = Column(line_start, cursor_position());
+    if (line_start == 0) {
+      cursor_position() = 0;
+      return true;
     }
 
-    MoveCursorColumn(static_cast<int>(columns));
+    cursor_position() = static_cast<int>(
+        ColumnToPosition(LineStart(line_start - 1), columns));
     return true;
   }
 
@@ -309,23 +303,16 @@ class InputBase : public ComponentBase, public InputOption {
       return false;
     }
 
-    const size_t columns = CursorColumn();
-
-    // Move cursor at the beginning of the next line
-    while (true) {
-      if (content()[cursor_position()] == '\n') {
-        break;
-      }
-      cursor_position() =
-          static_cast<int>(GlyphNext(content(), cursor_position()));
-      if (cursor_position() == (int)content().size()) {
-        return true;
-      }
+    const size_t line_start = LineStart(cursor_position());
+    const int columns = Column(line_start, cursor_position());
+    const size_t line_end = LineEnd(cursor_position());
+    if (line_end == content().size()) {
+      cursor_position() = static_cast<int>(line_end);
+      return true;
     }
-    cursor_position() =
-        static_cast<int>(GlyphNext(content(), cursor_position()));
 
-    MoveCursorColumn(static_cast<int>(columns));
+    cursor_position() =
+        static_cast<int>(ColumnToPosition(line_end + 1, columns));
     return true;
   }
 
@@ -352,7 +339,7 @@ class InputBase : public ComponentBase, public InputOption {
         content()[cursor_position()] != '\n') {
       DeleteImpl();
     }
-    content->insert(cursor_position(), character);
+    Insert(cursor_position(), character);
     cursor_position() += static_cast<int>(character.size());
     on_change();
     return true;
@@ -360,6 +347,7 @@ class InputBase : public ComponentBase, public InputOption {
 
   bool OnEvent(const Event& event) override {
     cursor_position() = util::clamp(cursor_position(), 0, (int)content->size());
+    IndexContent(/*compare_bytes=*/false);
 
     if (event == Event::Return) {
       return HandleReturn();
@@ -411,22 +399,18 @@ class InputBase : public ComponentBase, public InputOption {
       return false;
     }
 
+    size_t glyph = index_.ByteToGlyph(cursor_position());
     // Move left, as long as left it not a word.
-    while (cursor_position()) {
-      const size_t previous = GlyphPrevious(content(), cursor_position());
-      if (IsWordCharacter(content(), previous)) {
-        break;
-      }
-      cursor_position() = static_cast<int>(previous);
+    while (glyph > 0 &&
+           !IsWordCharacter(content(), index_.GlyphToByte(glyph - 1))) {
+      --glyph;
     }
     // Move left, as long as left is a word character:
-    while (cursor_position()) {
-      const size_t previous = GlyphPrevious(content(), cursor_position());
-      if (!IsWordCharacter(content(), previous)) {
-        break;
-      }
-      cursor_position() = static_cast<int>(previous);
+    while (glyph > 0 &&
+           IsWordCharacter(content(), index_.GlyphToByte(glyph - 1))) {
+      --glyph;
     }
+    cursor_position() = static_cast<int>(index_.GlyphToByte(glyph));
     return true;
   }
 
@@ -435,23 +419,18 @@ class InputBase : public ComponentBase, public InputOption {
       return false;
     }
 
+    size_t glyph = index_.ByteToGlyph(cursor_position());
     // Move right, until entering a word.
-    while (cursor_position() < (int)content().size()) {
-      cursor_position() =
-          static_cast<int>(GlyphNext(content(), cursor_position()));
-      if (IsWordCharacter(content(), cursor_position())) {
-        break;
-      }
-    }
+    do {
+      ++glyph;
+    } while (glyph < index_.size() &&
+             !IsWordCharacter(content(), index_.GlyphToByte(glyph)));
     // Move right, as long as right is a word character:
-    while (cursor_position() < (int)content().size()) {
-      const size_t next = GlyphNext(content(), cursor_position());
-      if (!IsWordCharacter(content(), cursor_position())) {
-        break;
-      }
-      cursor_position() = static_cast<int>(next);
+    while (glyph < index_.size() &&
+           IsWordCharacter(content(), index_.GlyphToByte(glyph))) {
+      ++glyph;
     }
-
+    cursor_position() = static_cast<int>(index_.GlyphToByte(glyph));
     return true;
   }
 
@@ -477,50 +456,37 @@ class InputBase : public ComponentBase, public InputOption {
       return true;
     }
 
-    // Find the line and index of the cursor.
-    std::vector<std::string> lines = Split(*content);
-    int cursor_line = 0;
-    int cursor_char_index = cursor_position();
-    for (const auto& line : lines) {
-      if (cursor_char_index <= (int)line.size()) {
+    // Find the line and the column of the cursor.
+    const size_t cursor_line = LineStart(cursor_position());
+    const int cursor_column = Column(cursor_line, cursor_position());
+
+    // Find the line clicked, moving line by line from the cursor's.
+    size_t new_cursor_line = cursor_line;
+    for (int i = event.mouse().y - cursor_box_.y_min; i < 0; ++i) {
+      if (new_cursor_line == 0) {
         break;
       }
-
-      cursor_char_index -= static_cast<int>(line.size() + 1);
-      cursor_line++;
+      new_cursor_line = LineStart(new_cursor_line - 1);
+    }
+    for (int i = event.mouse().y - cursor_box_.y_min; i > 0; --i) {
+      const size_t line_end = LineEnd(new_cursor_line);
+      if (line_end == content().size()) {
+        break;
+      }
+      new_cursor_line = line_end + 1;
     }
-    const int cursor_column =
-        string_width(lines[cursor_line].substr(0, cursor_char_index));
-
-    int new_cursor_column = cursor_column + event.mouse().x - cursor_box_.x_min;
-    int new_cursor_line = cursor_line + event.mouse().y - cursor_box_.y_min;
-
-    // Fix the new cursor position:
-    new_cursor_line = std::max(std::min(new_cursor_line, (int)lines.size()), 0);
 
-    const std::string empty_string;
-    const std::string& line = new_cursor_line < (int)lines.size()
-                                  ? lines[new_cursor_line]
-                                  : empty_string;
-    new_cursor_column = util::clamp(new_cursor_column, 0, string_width(line));
+    const int new_cursor_column =
+        util::clamp(cursor_column + event.mouse().x - cursor_box_.x_min, 0,
+                    Column(new_cursor_line, LineEnd(new_cursor_line)));
 
     if (new_cursor_column == cursor_column &&  //
         new_cursor_line == cursor_line) {
       return false;
     }
 
-    // Convert back the new_cursor_{line,column} toward cursor_position:
-    cursor_position() = 0;
-    for (int i = 0; i < new_cursor_line; ++i) {
-      cursor_position() += static_cast<int>(lines[i].size() + 1);
-    }
-    while (new_cursor_column > 0) {
-      new_cursor_column -=
-          static_cast<int>(GlyphWidth(content(), cursor_position()));
-      cursor_position() =
-          static_cast<int>(GlyphNext(content(), cursor_position()));
-    }
-
+    cursor_position() = static_cast<int>(
+        ColumnToPosition(new_cursor_line, new_cursor_column));
     on_change();
     return true;
   }
@@ -536,6 +502,10 @@ class InputBase : public ComponentBase, public InputOption {
 
   Box box_;
   Box cursor_box_;
+
+  // The glyphs of |indexed_content_|, a copy of the content.
+  GlyphIndex index_;
+  std::string indexed_content_;
 };
 
 }  // namespace
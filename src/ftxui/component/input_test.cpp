@@ -1,6 +1,7 @@
 // Copyright 2023 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
+#include <chrono>  // for milliseconds, steady_clock
 #include <string>  // for string
 
 #include "ftxui/component/component.hpp"       // for Input
@@ -781,4 +782,106 @@ TEST(InputTest, InsertMode) {
   EXPECT_EQ(content, "axyz\nefgX");
 }
 
+TEST(InputTest, LongLine) {
+  // Moving the cursor doesn't segment the whole line again. Walking through
+  // this line used to be quadratic.
+  const std::string word = "\U0001F1EB\U0001F1F7 abc ";  // 6 glyphs, 7 cells.
+  const int count = 20000;
+  std::string content;
+  for (int i = 0; i < count; ++i) {
+    content += word;
+  }
+  const int size = static_cast<int>(content.size());
+  int cursor_position = size;
+  auto input = Input(&content, {.cursor_position = &cursor_position});
+
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < 6 * count; ++i) {
+    EXPECT_TRUE(input->OnEvent(Event::ArrowLeft));
+  }
+  EXPECT_EQ(cursor_position, 0);
+  EXPECT_FALSE(input->OnEvent(Event::ArrowLeft));
+  for (int i = 0; i < 6 * count; ++i) {
+    EXPECT_TRUE(input->OnEvent(Event::ArrowRight));
+  }
+  EXPECT_EQ(cursor_position, size);
+  EXPECT_FALSE(input->OnEvent(Event::ArrowRight));
+
+  for (int i = 0; i < count; ++i) {
+    EXPECT_TRUE(input->OnEvent(Event::ArrowLeftCtrl));
+  }
+  EXPECT_EQ(cursor_position, 9);
+  for (int i = 0; i < count; ++i) {
+    EXPECT_TRUE(input->OnEvent(Event::ArrowRightCtrl));
+  }
+  EXPECT_EQ(cursor_position, size - 1);
+
+  // Edit at the start of the line. An edit moves the bytes after it, like
+  // the content does.
+  EXPECT_TRUE(input->OnEvent(Event::Home));
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_TRUE(input->OnEvent(Event::Character("x")));
+    EXPECT_TRUE(input->OnEvent(Event::ArrowLeft));
+    EXPECT_TRUE(input->OnEvent(Event::Delete));
+  }
+  EXPECT_TRUE(input->OnEvent(Event::ArrowRight));
+  EXPECT_TRUE(input->OnEvent(Event::Character("\u0301")));  // Joins the flag.
+  EXPECT_EQ(cursor_position, 10);
+  EXPECT_TRUE(input->OnEvent(Event::ArrowLeft));
+  EXPECT_EQ(cursor_position, 0);
+  EXPECT_TRUE(input->OnEvent(Event::Delete));
+  EXPECT_EQ(content.size(), size - 8);
+  EXPECT_EQ(content.substr(0, 5), " abc ");
+  const auto duration = std::chrono::steady_clock::now() - start;
+  EXPECT_LT(duration, std::chrono::seconds(2));
+
+  // Click on the line.
+  auto render = [&] {
+    auto document = input->Render();
+    auto screen = Screen::Create(Dimension::Fixed(80), Dimension::Fixed(1));
+    Render(screen, document);
+  };
+  render();
+
+  Mouse mouse;
+  mouse.button = Mouse::Button::Left;
+  mouse.motion = Mouse::Motion::Pressed;
+  mouse.shift = false;
+  mouse.meta = false;
+  mouse.control = false;
+  mouse.y = 0;
+
+  mouse.x = 6;  // On the second half of the flag.
+  EXPECT_TRUE(input->OnEvent(Event::Mouse("", mouse)));
+  render();
+  EXPECT_EQ(cursor_position, 13);
+
+  mouse.x = 5;  // On the flag.
+  EXPECT_TRUE(input->OnEvent(Event::Mouse("", mouse)));
+  render();
+  EXPECT_EQ(cursor_position, 5);
+
+  mouse.x = 4;  // On the space before.
+  EXPECT_TRUE(input->OnEvent(Event::Mouse("", mouse)));
+  render();
+  EXPECT_EQ(cursor_position, 4);
+}
+
+TEST(InputTest, ContentModifiedOutside) {
+  std::string content = "abc";
+  int cursor_position = 3;
+  auto input = Input(&content, {.cursor_position = &cursor_position});
+
+  EXPECT_TRUE(input->OnEvent(Event::ArrowLeft));
+  EXPECT_EQ(cursor_position, 2);
+
+  content = "测试";
+  cursor_position = 6;
+  EXPECT_TRUE(input->OnEvent(Event::ArrowLeft));
+  EXPECT_EQ(cursor_position, 3);
+  EXPECT_TRUE(input->OnEvent(Event::Backspace));
+  EXPECT_EQ(content, "试");
+  EXPECT_EQ(cursor_position, 0);
+}
+
 }  // namespace ftxui
@@ -60,7 +60,7 @@ TEST(MenuTest, DirectionDown) {
   Screen screen(4, 3);
   Render(screen, menu->Render());
   EXPECT_EQ(screen.ToString(),
-            "\x1B[1m\x1B[7m> 1 \x1B[22m\x1B[27m\r\n"
+            "\x1B[1;7m> 1 \x1B[22;27m\r\n"
             "  2 \r\n"
             "  3 ");
 
@@ -87,7 +87,7 @@ TEST(MenuTest, DirectionsUp) {
   EXPECT_EQ(screen.ToString(),
             "  3 \r\n"
             "  2 \r\n"
-            "\x1B[1m\x1B[7m> 1 \x1B[22m\x1B[27m");
+            "\x1B[1;7m> 1 \x1B[22;27m");
   menu->OnEvent(Event::ArrowDown);
   EXPECT_EQ(selected, 0);
   menu->OnEvent(Event::ArrowUp);
@@ -109,7 +109,7 @@ TEST(MenuTest, DirectionsRight) {
   Screen screen(10, 1);
   Render(screen, menu->Render());
   EXPECT_EQ(screen.ToString(),
-            "\x1B[1m\x1B[7m> 1\x1B[22m\x1B[27m"
+            "\x1B[1;7m> 1\x1B[22;27m"
             "  2"
             "  3 ");
   menu->OnEvent(Event::ArrowLeft);
@@ -135,7 +135,7 @@ TEST(MenuTest, DirectionsLeft) {
   EXPECT_EQ(screen.ToString(),
             "  3"
             "  2"
-            "\x1B[1m\x1B[7m> 1\x1B[22m\x1B[27m ");
+            "\x1B[1;7m> 1\x1B[22;27m ");
   menu->OnEvent(Event::ArrowRight);
   EXPECT_EQ(selected, 0);
   menu->OnEvent(Event::ArrowLeft);
@@ -159,9 +159,8 @@ TEST(MenuTest, AnimationsHorizontal) {
     Render(screen, menu->Render());
     EXPECT_EQ(
         screen.ToString(),
-        "\x1B[1m\x1B[7m1\x1B[22m\x1B[27m \x1B[2m2\x1B[22m "
-        "\r\n\x1B[97m\x1B[49m\xE2\x94\x80\x1B[90m\x1B["
-        "49m\xE2\x95\xB6\xE2\x94\x80\xE2\x94\x80\x1B[39m\x1B[49m\r\n    ");
+        "\x1B[1;7m1\x1B[22;27m \x1B[2m2\x1B[22m \r\n\x1B[97;49m\xE2\x94\x80"
+        "\x1B[90;49m\xE2\x95\xB6\xE2\x94\x80\xE2\x94\x80\x1B[39;49m\r\n    ");
   }
   selected = 1;
   {
@@ -169,9 +168,8 @@ TEST(MenuTest, AnimationsHorizontal) {
     Render(screen, menu->Render());
     EXPECT_EQ(
         screen.ToString(),
-        "\x1B[7m1\x1B[27m \x1B[1m2\x1B[22m "
-        "\r\n\x1B[97m\x1B[49m\xE2\x94\x80\x1B[90m\x1B["
-        "49m\xE2\x95\xB6\xE2\x94\x80\xE2\x94\x80\x1B[39m\x1B[49m\r\n    ");
+        "\x1B[7m1\x1B[27m \x1B[1m2\x1B[22m \r\n\x1B[97;49m\xE2\x94\x80"
+        "\x1B[90;49m\xE2\x95\xB6\xE2\x94\x80\xE2\x94\x80\x1B[39;49m\r\n    ");
   }
   animation::Params params(2s);
   menu->OnAnimation(params);
@@ -180,9 +178,9 @@ TEST(MenuTest, AnimationsHorizontal) {
     Render(screen, menu->Render());
     EXPECT_EQ(
         screen.ToString(),
-        "\x1B[7m1\x1B[27m \x1B[1m2\x1B[22m "
-        "\r\n\x1B[90m\x1B[49m\xE2\x94\x80\xE2\x95\xB4\x1B[97m\x1B["
-        "49m\xE2\x94\x80\x1B[90m\x1B[49m\xE2\x95\xB6\x1B[39m\x1B[49m\r\n    ");
+        "\x1B[7m1\x1B[27m \x1B[1m2\x1B[22m \r\n"
+        "\x1B[90;49m\xE2\x94\x80\xE2\x95\xB4\x1B[97;49m\xE2\x94\x80"
+        "\x1B[90;49m\xE2\x95\xB6\x1B[39;49m\r\n    ");
   }
 }
 
@@ -195,11 +193,9 @@ TEST(MenuTest, AnimationsVertical) {
     Render(screen, menu->Render());
     EXPECT_EQ(
         screen.ToString(),
-        "\x1B[90m\x1B[49m\xE2\x94\x82\x1B[1m\x1B[7m\x1B[39m\x1B[49m1\x1B["
-        "22m\x1B[27m        "
-        "\r\n\x1B[97m\x1B[49m\xE2\x95\xB7\x1B[2m\x1B[39m\x1B[49m2\x1B[22m      "
-        "  \r\n\x1B[97m\x1B[49m\xE2\x94\x82\x1B[2m\x1B[39m\x1B[49m3\x1B[22m    "
-        "    ");
+        "\x1B[90;49m\xE2\x94\x82\x1B[1;7;39;49m1\x1B[22;27m        \r\n"
+        "\x1B[97;49m\xE2\x95\xB7\x1B[2;39;49m2\x1B[22m        \r\n"
+        "\x1B[97;49m\xE2\x94\x82\x1B[2;39;49m3\x1B[22m        ");
   }
   selected = 1;
   {
@@ -207,10 +203,9 @@ TEST(MenuTest, AnimationsVertical) {
     Render(screen, menu->Render());
     EXPECT_EQ(
         screen.ToString(),
-        "\x1B[90m\x1B[49m\xE2\x94\x82\x1B[7m\x1B[39m\x1B[49m1\x1B[27m        "
-        "\r\n\x1B[97m\x1B[49m\xE2\x95\xB7\x1B[1m\x1B[39m\x1B[49m2\x1B[22m      "
-        "  \r\n\x1B[97m\x1B[49m\xE2\x94\x82\x1B[2m\x1B[39m\x1B[49m3\x1B[22m    "
-        "    ");
+        "\x1B[90;49m\xE2\x94\x82\x1B[7;39;49m1\x1B[27m        \r\n"
+        "\x1B[97;49m\xE2\x95\xB7\x1B[1;39;49m2\x1B[22m        \r\n"
+        "\x1B[97;49m\xE2\x94\x82\x1B[2;39;49m3\x1B[22m        ");
   }
   animation::Params params(2s);
   menu->OnAnimation(params);
@@ -219,10 +214,9 @@ TEST(MenuTest, AnimationsVertical) {
     Render(screen, menu->Render());
     EXPECT_EQ(
         screen.ToString(),
-        "\x1B[97m\x1B[49m\xE2\x95\xB5\x1B[7m\x1B[39m\x1B[49m1\x1B[27m        "
-        "\r\n\x1B[90m\x1B[49m\xE2\x94\x82\x1B[1m\x1B[39m\x1B[49m2\x1B[22m      "
-        "  \r\n\x1B[97m\x1B[49m\xE2\x95\xB7\x1B[2m\x1B[39m\x1B[49m3\x1B[22m    "
-        "    ");
+        "\x1B[97;49m\xE2\x95\xB5\x1B[7;39;49m1\x1B[27m        \r\n"
+        "\x1B[90;49m\xE2\x94\x82\x1B[1;39;49m2\x1B[22m        \r\n"
+        "\x1B[97;49m\xE2\x95\xB7\x1B[2;39;49m3\x1B[22m        ");
   }
 }
 
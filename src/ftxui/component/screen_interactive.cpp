@@ -30,11 +30,13 @@
 #include "ftxui/component/loop.hpp"            // for Loop
 #include "ftxui/component/receiver.hpp"  // for ReceiverImpl, Sender, MakeReceiver, SenderImpl, Receiver
 #include "ftxui/component/terminal_input_parser.hpp"  // for TerminalInputParser
+#include "ftxui/component/terminal_writer.hpp"        // for TerminalWriter
+#include "ftxui/dom/element_arena.hpp"                // for ElementArena
 #include "ftxui/dom/node.hpp"                         // for Node, Render
 #include "ftxui/dom/requirement.hpp"                  // for Requirement
 #include "ftxui/screen/pixel.hpp"                     // for Pixel
 #include "ftxui/screen/terminal.hpp"                  // for Dimensions, Size
-#include "ftxui/screen/util.hpp"                      // for util::clamp
+#include "ftxui/screen/util.hpp"                      // for clamp, AppendNumber
 
 #if defined(_WIN32)
 #define DEFINE_CONSOLEV2_PROPERTIES
@@ -363,6 +365,8 @@ ScreenInteractive::ScreenInteractive(Dimension dimension,
   task_receiver_ = MakeReceiver<Task>();
 }
 
+ScreenInteractive::~ScreenInteractive() = default;
+
 // static
 ScreenInteractive ScreenInteractive::FixedSize(int dimx, int dimy) {
   return {
@@ -453,6 +457,26 @@ void ScreenInteractive::TrackMouse(bool enable) {
   track_mouse_ = enable;
 }
 
+/// @brief Set whether the elements of each frame are allocated from an
+/// `ElementArena`, released once the frame is drawn. This saves allocating and
+/// freeing every element on the heap.
+/// @param enable Whether to allocate the elements from an arena.
+/// @note The elements returned by `Component::Render()` may be kept across
+/// frames, but the memory of a frame is reused only once all its elements are
+/// destroyed.
+/// @note The arena is disabled by default.
+///
+/// ### Example
+///
+/// ```cpp
+/// auto screen = ScreenInteractive::Fullscreen();
+/// screen.UseElementArena();
+/// screen.Loop(component);
+/// ```
+void ScreenInteractive::UseElementArena(bool enable) {
+  element_arena_ = enable ? std::make_unique<ElementArena>() : nullptr;
+}
+
 /// @brief Add a task to the main loop.
 /// It will be executed later, after every other scheduled tasks.
 ScreenInteractive& ScreenInteractive::Post(Task task) {
@@ -613,6 +637,9 @@ ScreenInteractive* ScreenInteractive::Active() {
 void ScreenInteractive::Install() {
   frame_valid_ = false;
 
+  // The terminal content might have been modified while uninstalled.
+  front_buffer_valid_ = false;
+
   // Flush the buffer for stdout to ensure whatever the user has printed before
   // is fully applied before we start modifying the terminal configuration. This
   // is important, because we are using two different channels (stdout vs
@@ -743,6 +770,9 @@ void ScreenInteractive::Install() {
   // ensure it is fully applied:
   Flush();
 
+  // From now on, the frames bypass std::cout.
+  terminal_writer_ = std::make_unique<TerminalWriter>();
+
   quit_ = false;
   task_sender_ = task_receiver_->MakeSender();
   event_listener_ =
@@ -753,6 +783,7 @@ void ScreenInteractive::Install() {
 
 // private
 void ScreenInteractive::Uninstall() {
+  terminal_writer_.reset();  // Write the remaining frames.
   ExitNow();
   event_listener_.join();
   animation_listener_.join();
@@ -920,11 +951,21 @@ void ScreenInteractive::Draw(Component component) {
   if (frame_valid_) {
     return;
   }
+
+  // The terminal can't keep up. Skip this frame, the next one will show the
+  // latest state. The animation ticks ensure it will be drawn eventually.
+  if (terminal_writer_ && terminal_writer_->Behind()) {
+    return;
+  }
+
+  // The elements of this frame are allocated from the arena, if any. It is
+  // released once they are destroyed.
+  const ElementArena::Scope arena_scope(element_arena_.get());
   auto document = component->Render();
   int dimx = 0;
   int dimy = 0;
   auto terminal = Terminal::Size();
-  document->ComputeRequirement();
+  document->ComputeRequirementIfDirty();
   switch (dimension_) {
     case Dimension::Fixed:
       dimx = dimx_;
@@ -945,23 +986,25 @@ void ScreenInteractive::Draw(Component component) {
   }
 
   const bool resized = frame_count_ == 0 || (dimx != dimx_) || (dimy != dimy_);
-  ResetCursorPosition();
-  std::cout << ResetPosition(/*clear=*/resized);
+  output_buffer_.clear();
+  output_buffer_ += reset_cursor_position;
+  reset_cursor_position.clear();
+  output_buffer_ += ResetPosition(/*clear=*/resized);
 
   // If the terminal width decrease, the terminal emulator will start wrapping
   // lines and make the display dirty. We should clear it completely.
   if ((dimx < dimx_) && !use_alternative_screen_) {
-    std::cout << "\033[J";  // clear terminal output
-    std::cout << "\033[H";  // move cursor to home position
+    output_buffer_ += "\033[J";  // clear terminal output
+    output_buffer_ += "\033[H";  // move cursor to home position
   }
 
   // Resize the screen if needed.
   if (resized) {
-    dimx_ = dimx;
-    dimy_ = dimy;
-    pixels_ = std::vector<std::vector<Pixel>>(dimy, std::vector<Pixel>(dimx));
+    Resize(dimx, dimy);
     cursor_.x = dimx_ - 1;
     cursor_.y = dimy_ - 1;
+    front_buffer_.Resize(dimx, dimy);
+    front_buffer_valid_ = false;
   }
 
   // Periodically request the terminal emulator the frame position relative to
@@ -977,14 +1020,14 @@ void ScreenInteractive::Draw(Component component) {
   static int i = -3;
   ++i;
   if (!use_alternative_screen_ && (i % 150 == 0)) {  // NOLINT
-    std::cout << DeviceStatusReport(DSRMode::kCursor);
+    output_buffer_ += DeviceStatusReport(DSRMode::kCursor);
   }
 #else
   static int i = -3;
   ++i;
   if (!use_alternative_screen_ &&
       (previous_frame_resized_ || i % 40 == 0)) {  // NOLINT
-    std::cout << DeviceStatusReport(DSRMode::kCursor);
+    output_buffer_ += DeviceStatusReport(DSRMode::kCursor);
   }
 #endif
   previous_frame_resized_ = resized;
@@ -1005,33 +1048,65 @@ void ScreenInteractive::Draw(Component component) {
     reset_cursor_position.clear();
 
     if (dy != 0) {
-      set_cursor_position += "\x1B[" + std::to_string(dy) + "A";
-      reset_cursor_position += "\x1B[" + std::to_string(dy) + "B";
+      set_cursor_position += "\x1B[";
+      util::AppendNumber(set_cursor_position, dy);
+      set_cursor_position += 'A';
+      reset_cursor_position += "\x1B[";
+      util::AppendNumber(reset_cursor_position, dy);
+      reset_cursor_position += 'B';
     }
 
     if (dx != 0) {
-      set_cursor_position += "\x1B[" + std::to_string(dx) + "D";
-      reset_cursor_position += "\x1B[" + std::to_string(dx) + "C";
+      set_cursor_position += "\x1B[";
+      util::AppendNumber(set_cursor_position, dx);
+      set_cursor_position += 'D';
+      reset_cursor_position += "\x1B[";
+      util::AppendNumber(reset_cursor_position, dx);
+      reset_cursor_position += 'C';
     }
 
     if (cursor_.shape == Cursor::Hidden) {
       set_cursor_position += "\033[?25l";
     } else {
       set_cursor_position += "\033[?25h";
-      set_cursor_position +=
-          "\033[" + std::to_string(int(cursor_.shape)) + " q";
+      set_cursor_position += "\033[";
+      util::AppendNumber(set_cursor_position, int(cursor_.shape));
+      set_cursor_position += " q";
     }
   }
 
-  std::cout << ToString() << set_cursor_position;
-  Flush();
+  // Only print the cells that changed since the previous frame, unless the
+  // terminal content is unknown.
+  if (front_buffer_valid_) {
+    ToString(front_buffer_, output_buffer_);
+  } else {
+    ToString(output_buffer_);
+  }
+  output_buffer_ += set_cursor_position;
+  output_buffer_ += '\0';  // Emscripten interprets zero as flush.
+  if (terminal_writer_) {
+    terminal_writer_->Write(output_buffer_);
+  }
+
+  // Retain this frame and reuse the previous one as the next back buffer.
+  Swap(front_buffer_);
+  front_buffer_valid_ = true;
   Clear();
   frame_valid_ = true;
   frame_count_++;
+
+  document = nullptr;
+  if (element_arena_) {
+    element_arena_->Release();
+  }
 }
 
 // private
 void ScreenInteractive::ResetCursorPosition() {
+  // The frames are written asynchronously. Let them complete before printing.
+  if (terminal_writer_) {
+    terminal_writer_->Wait();
+  }
   std::cout << reset_cursor_position;
   reset_cursor_position = "";
 }
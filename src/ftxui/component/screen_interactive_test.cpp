@@ -241,4 +241,47 @@ TEST(ScreenInteractive, FixedSizeInitialFrame) {
 #endif
 }
 
+TEST(ScreenInteractive, FixedSizeDifferentialFrame) {
+#if defined(__unix__)
+  std::string output;
+  {
+    auto capture = StdCapture(&output);
+
+    auto screen = ScreenInteractive::FixedSize(2, 2);
+    std::string content = "AB";
+    auto component = Renderer([&] { return text(content); });
+
+    Loop loop(&screen, component);
+    loop.RunOnce();
+    content = "AC";
+    screen.PostEvent(Event::Custom);
+    loop.RunOnce();
+  }
+  using namespace std::string_view_literals;
+
+  auto expected =
+      // Move the cursor back to the top-left corner.
+      "\x1B[1C"  // Move cursor right one character.
+      "\r"       // Reset cursor position.
+      "\x1B[1A"  // Move cursor up one line.
+      "\x1B[6n"  // Request cursor position.
+
+      // Print the modified cell only.
+      "\x1B[1C"  // Move cursor right one character.
+      "C"
+
+      // Print the last cell, to move the cursor at the end.
+      "\x1B[1B"  // Move cursor down one line.
+      "\r"       // Reset cursor position.
+      "\x1B[1C"  // Move cursor right one character.
+      " "
+
+      // Set cursor position.
+      "\x1B[1D"    // Move cursor left one character.
+      "\x1B[?25l"  // Hide cursor.
+      "\0"sv;      // Flush stdout.
+  EXPECT_NE(output.find(expected), std::string::npos);
+#endif
+}
+
 }  // namespace ftxui
@@ -6,17 +6,24 @@
 #include <cstdint>                    // for uint32_t
 #include <ftxui/component/mouse.hpp>  // for Mouse, Mouse::Button, Mouse::Motion
 #include <functional>                 // for std::function
-#include <map>
-#include <memory>   // for unique_ptr, allocator
-#include <utility>  // for move
+#include <memory>       // for unique_ptr, allocator
+#include <string_view>  // for string_view
+#include <utility>      // for move
 #include <vector>
 #include "ftxui/component/event.hpp"  // for Event
 #include "ftxui/component/task.hpp"   // for Task
 
 namespace ftxui {
 
+namespace {
+
+struct Uniformize {
+  std::string_view from;
+  std::string_view to;
+};
+
 // NOLINTNEXTLINE
-const std::map<std::string, std::string> g_uniformize = {
+constexpr Uniformize g_uniformize[] = {
     // Microsoft's terminal uses a different new line character for the return
     // key. This also happens with linux with the `bind` command:
     // See https://github.com/ArthurSonzogni/FTXUI/issues/337
@@ -24,7 +31,7 @@ const std::map<std::string, std::string> g_uniformize = {
     {"\r", "\n"},
 
     // See: https://github.com/ArthurSonzogni/FTXUI/issues/508
-    {std::string({8}), std::string({127})},
+    {"\x08", "\x7F"},
 
     // See: https://github.com/ArthurSonzogni/FTXUI/issues/626
     //
@@ -90,6 +97,8 @@ const std::map<std::string, std::string> g_uniformize = {
     {"\x1B[X", "\x1B[24~"},  // F12
 };
 
+}  // namespace
+
 TerminalInputParser::TerminalInputParser(std::function<void(Event)> out)
     : out_(std::move(out)) {}
 
@@ -136,9 +145,11 @@ void TerminalInputParser::Send(TerminalInputParser::Output output) {
       return;
 
     case SPECIAL: {
-      auto it = g_uniformize.find(pending_);
-      if (it != g_uniformize.end()) {
-        pending_ = it->second;
+      for (const Uniformize& uniformize : g_uniformize) {
+        if (pending_ == uniformize.from) {
+          pending_ = uniformize.to;
+          break;
+        }
       }
       out_(Event::Special(std::move(pending_)));
       pending_.clear();
@@ -0,0 +1,123 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/component/terminal_writer.hpp"
+
+#include <mutex>    // for unique_lock, lock_guard
+#include <string>   // for string
+#include <thread>   // for thread
+#include <utility>  // for swap
+
+#if defined(_WIN32) || defined(__EMSCRIPTEN__)
+#include <iostream>  // for cout
+#else
+#include <cerrno>    // for errno, EINTR
+#include <unistd.h>  // for write, ssize_t
+#endif
+
+namespace ftxui {
+
+#if defined(_WIN32) || defined(__EMSCRIPTEN__)
+
+// Threads are unavailable with Emscripten, and the Windows console is driven
+// through std::cout. The frames are written synchronously.
+
+TerminalWriter::TerminalWriter(int fd) : fd_(fd) {}
+
+TerminalWriter::~TerminalWriter() = default;
+
+bool TerminalWriter::Behind() {
+  return false;
+}
+
+void TerminalWriter::Write(std::string& frame) {
+  std::cout.write(frame.data(), static_cast<std::streamsize>(frame.size()));
+  std::cout.flush();
+  frame.clear();
+}
+
+void TerminalWriter::Wait() {}
+
+void TerminalWriter::Run() {}
+
+#else
+
+namespace {
+
+void WriteAll(int fd, const std::string& data) {
+  size_t written = 0;
+  while (written < data.size()) {
+    const ssize_t n = ::write(fd, data.data() + written, data.size() - written);
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return;  // The terminal is gone. Drop the frame.
+    }
+    written += static_cast<size_t>(n);
+  }
+}
+
+}  // namespace
+
+TerminalWriter::TerminalWriter(int fd) : fd_(fd) {
+  thread_ = std::thread(&TerminalWriter::Run, this);
+}
+
+TerminalWriter::~TerminalWriter() {
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    quit_ = true;
+  }
+  cv_.notify_all();
+  thread_.join();
+}
+
+bool TerminalWriter::Behind() {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  return busy_ && !pending_.empty();
+}
+
+void TerminalWriter::Write(std::string& frame) {
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    if (pending_.empty()) {
+      std::swap(pending_, frame);
+    } else {
+      pending_ += frame;
+      frame.clear();
+    }
+  }
+  cv_.notify_all();
+}
+
+void TerminalWriter::Wait() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  cv_.wait(lock, [this] { return !busy_ && pending_.empty(); });
+}
+
+void TerminalWriter::Run() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    cv_.wait(lock, [this] { return quit_ || !pending_.empty(); });
+    if (pending_.empty()) {
+      return;  // Quit, with everything written.
+    }
+
+    // Take the pending frame, and give back the buffer written previously.
+    writing_.clear();
+    std::swap(writing_, pending_);
+    busy_ = true;
+
+    lock.unlock();
+    WriteAll(fd_, writing_);
+    lock.lock();
+
+    busy_ = false;
+    cv_.notify_all();
+  }
+}
+
+#endif
+
+}  // namespace ftxui
@@ -0,0 +1,56 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_COMPONENT_TERMINAL_WRITER
+#define FTXUI_COMPONENT_TERMINAL_WRITER
+
+#include <condition_variable>  // for condition_variable
+#include <mutex>               // for mutex
+#include <string>              // for string
+#include <thread>              // for thread
+
+namespace ftxui {
+
+// Write the frames to the terminal from a dedicated thread, so that a slow
+// terminal doesn't block the UI thread.
+//
+// At most one frame is written while a second one waits. The producer is
+// expected to check |Behind()| and to skip the frames it can't hand off. This
+// way, only the latest state is printed once the terminal catches up.
+class TerminalWriter {
+ public:
+  // |fd| is the file descriptor to write to. Defaults to stdout.
+  explicit TerminalWriter(int fd = 1);
+  ~TerminalWriter();
+  TerminalWriter(const TerminalWriter&) = delete;
+  TerminalWriter(TerminalWriter&&) = delete;
+  TerminalWriter& operator=(const TerminalWriter&) = delete;
+  TerminalWriter& operator=(TerminalWriter&&) = delete;
+
+  // Whether a frame is waiting for the previous one to be written.
+  bool Behind();
+
+  // Hand off |frame|. It is exchanged with a cleared buffer, whose capacity
+  // can be reused for the next frame.
+  void Write(std::string& frame);
+
+  // Block until every frame handed off has been written.
+  void Wait();
+
+ private:
+  void Run();
+
+  // Unused when the frames are written synchronously.
+  [[maybe_unused]] const int fd_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::string pending_;  // Handed off, not yet picked up.
+  std::string writing_;  // Owned by the thread while |busy_|.
+  [[maybe_unused]] bool busy_ = false;
+  [[maybe_unused]] bool quit_ = false;
+  std::thread thread_;
+};
+
+}  // namespace ftxui
+
+#endif /* end of include guard: FTXUI_COMPONENT_TERMINAL_WRITER */
@@ -0,0 +1,91 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>  // for Test, TEST, EXPECT_EQ, EXPECT_TRUE
+#include <string>         // for string
+#include <thread>         // for thread, yield
+
+#include "ftxui/component/terminal_writer.hpp"
+
+#if defined(__unix__)
+#include <unistd.h>  // for pipe, read, close
+#endif
+
+// NOLINTBEGIN
+namespace ftxui {
+
+#if defined(__unix__)
+
+namespace {
+
+std::string ReadAll(int fd) {
+  std::string out;
+  char buffer[1024];
+  ssize_t count;
+  while ((count = read(fd, buffer, sizeof(buffer))) > 0) {
+    out.append(buffer, count);
+  }
+  return out;
+}
+
+}  // namespace
+
+TEST(TerminalWriter, Write) {
+  int fd[2];
+  ASSERT_EQ(pipe(fd), 0);
+  {
+    TerminalWriter writer(fd[1]);
+    std::string frame = "abc";
+    writer.Write(frame);
+    EXPECT_TRUE(frame.empty());
+    frame = "def";
+    writer.Write(frame);
+    writer.Wait();
+    EXPECT_FALSE(writer.Behind());
+  }
+  close(fd[1]);
+  EXPECT_EQ(ReadAll(fd[0]), "abcdef");
+  close(fd[0]);
+}
+
+TEST(TerminalWriter, Behind) {
+  int fd[2];
+  ASSERT_EQ(pipe(fd), 0);
+  std::string expected;
+  {
+    TerminalWriter writer(fd[1]);
+
+    // Larger than the pipe capacity, nobody reads yet: the writer blocks.
+    std::string frame(1 << 20, 'a');
+    expected += frame;
+    writer.Write(frame);
+
+    // Once the writer is blocked, the next frames wait.
+    while (!writer.Behind()) {
+      frame = "b";
+      expected += frame;
+      writer.Write(frame);
+      std::this_thread::yield();
+    }
+
+    // Late frames are still written, in order.
+    frame = "c";
+    expected += frame;
+    writer.Write(frame);
+    EXPECT_TRUE(writer.Behind());
+
+    std::string output;
+    std::thread reader([&] { output = ReadAll(fd[0]); });
+    writer.Wait();
+    EXPECT_FALSE(writer.Behind());
+    close(fd[1]);
+    reader.join();
+    EXPECT_EQ(output, expected);
+  }
+  close(fd[0]);
+}
+
+#endif
+
+}  // namespace ftxui
+// NOLINTEND
@@ -6,10 +6,12 @@ export module ftxui.dom;
 export import ftxui.dom.canvas;
 export import ftxui.dom.deprecated;
 export import ftxui.dom.direction;
+export import ftxui.dom.element_arena;
 export import ftxui.dom.elements;
 export import ftxui.dom.flexbox_config;
 export import ftxui.dom.linear_gradient;
 export import ftxui.dom.node;
 export import ftxui.dom.requirement;
 export import ftxui.dom.selection;
+export import ftxui.dom.styled_text;
 export import ftxui.dom.table;
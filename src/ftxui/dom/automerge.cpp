@@ -4,6 +4,7 @@
 #include <memory>   // for make_shared
 #include <utility>  // for move
 
+#include "ftxui/dom/element_arena.hpp"   // for MakeElement
 #include "ftxui/dom/elements.hpp"        // for Element, automerge
 #include "ftxui/dom/node.hpp"            // for Node
 #include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
@@ -21,15 +22,16 @@ Element automerge(Element child) {
 
     void Render(Screen& screen) override {
       for (int y = box_.y_min; y <= box_.y_max; ++y) {
-        for (int x = box_.x_min; x <= box_.x_max; ++x) {
-          screen.PixelAt(x, y).automerge = true;
+        for (Pixel& pixel : screen.Row(y, box_.x_min, box_.x_max)) {
+          pixel.automerge = true;
         }
+        screen.MarkAutomerge(y);
       }
       Node::Render(screen);
     }
   };
 
-  return std::make_shared<Impl>(std::move(child));
+  return MakeElement<Impl>(std::move(child));
 }
 
 }  // namespace ftxui
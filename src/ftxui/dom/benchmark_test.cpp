@@ -3,6 +3,7 @@
 // the LICENSE file.
 #include <benchmark/benchmark.h>
 
+#include "ftxui/dom/element_arena.hpp"  // for ElementArena
 #include "ftxui/dom/elements.hpp"  // for gauge, separator, operator|, text, Element, hbox, vbox, blink, border, inverted
 #include "ftxui/dom/node.hpp"      // for Render
 #include "ftxui/screen/screen.hpp"  // for Screen
@@ -82,5 +83,33 @@ BENCHMARK(BenchmarkStyle)
         benchmark::CreateDenseRange(10, 200, 20),  // Screen width.
     });
 
+// Build and destroy a frame of many elements, from the heap (0) or from an
+// ElementArena (1).
+static void BenchmarkElementArena(benchmark::State& state) {
+  ElementArena arena;
+  const bool use_arena = state.range(1);
+  while (state.KeepRunning()) {
+    {
+      const ElementArena::Scope scope(use_arena ? &arena : nullptr);
+      Elements lines;
+      for (int i = 0; i < state.range(0); ++i) {
+        lines.push_back(hbox({
+            text("Test") | bold,
+            separator(),
+            text("Test") | color(Color::Red),
+        }));
+      }
+      auto document = vbox(std::move(lines)) | border;
+      benchmark::DoNotOptimize(document);
+    }
+    arena.Release();
+  }
+}
+BENCHMARK(BenchmarkElementArena)
+    ->ArgsProduct({
+        {100, 1000, 10000},  // Number of lines.
+        {0, 1},              // Whether to use an arena.
+    });
+
 }  // namespace ftxui
 // NOLINTEND
@@ -4,6 +4,7 @@
 #include <memory>   // for make_shared
 #include <utility>  // for move
 
+#include "ftxui/dom/element_arena.hpp"   // for MakeElement
 #include "ftxui/dom/elements.hpp"        // for Element, blink
 #include "ftxui/dom/node.hpp"            // for Node
 #include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
@@ -20,8 +21,8 @@ class Blink : public NodeDecorator {
   void Render(Screen& screen) override {
     Node::Render(screen);
     for (int y = box_.y_min; y <= box_.y_max; ++y) {
-      for (int x = box_.x_min; x <= box_.x_max; ++x) {
-        screen.PixelAt(x, y).blink = true;
+      for (Pixel& pixel : screen.Row(y, box_.x_min, box_.x_max)) {
+        pixel.blink = true;
       }
     }
   }
@@ -31,7 +32,7 @@ class Blink : public NodeDecorator {
 /// @brief The text drawn alternates in between visible and hidden.
 /// @ingroup dom
 Element blink(Element child) {
-  return std::make_shared<Blink>(std::move(child));
+  return MakeElement<Blink>(std::move(child));
 }
 
 }  // namespace ftxui
@@ -4,6 +4,7 @@
 #include <memory>   // for make_shared
 #include <utility>  // for move
 
+#include "ftxui/dom/element_arena.hpp"   // for MakeElement
 #include "ftxui/dom/elements.hpp"        // for Element, bold
 #include "ftxui/dom/node.hpp"            // for Node
 #include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
@@ -19,8 +20,8 @@ class Bold : public NodeDecorator {
 
   void Render(Screen& screen) override {
     for (int y = box_.y_min; y <= box_.y_max; ++y) {
-      for (int x = box_.x_min; x <= box_.x_max; ++x) {
-        screen.PixelAt(x, y).bold = true;
+      for (Pixel& pixel : screen.Row(y, box_.x_min, box_.x_max)) {
+        pixel.bold = true;
       }
     }
     Node::Render(screen);
@@ -31,7 +32,7 @@ class Bold : public NodeDecorator {
 /// @brief Use a bold font, for elements with more emphasis.
 /// @ingroup dom
 Element bold(Element child) {
-  return std::make_shared<Bold>(std::move(child));
+  return MakeElement<Bold>(std::move(child));
 }
 
 }  // namespace ftxui
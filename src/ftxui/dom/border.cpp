@@ -4,25 +4,27 @@
 #include <algorithm>               // for max
 #include <array>                   // for array
 #include <ftxui/screen/color.hpp>  // for Color
-#include <memory>    // for allocator, make_shared, __shared_ptr_access
-#include <optional>  // for optional, nullopt
-#include <string>    // for basic_string, string
-#include <utility>   // for move
-
-#include "ftxui/dom/elements.hpp"  // for unpack, Element, Decorator, BorderStyle, ROUNDED, borderStyled, Elements, DASHED, DOUBLE, EMPTY, HEAVY, LIGHT, border, borderDashed, borderDouble, borderEmpty, borderHeavy, borderLight, borderRounded, borderWith, window
-#include "ftxui/dom/node.hpp"      // for Node, Elements
-#include "ftxui/dom/requirement.hpp"  // for Requirement
-#include "ftxui/screen/box.hpp"       // for Box
-#include "ftxui/screen/pixel.hpp"     // for Pixel
-#include "ftxui/screen/screen.hpp"    // for Pixel, Screen
+#include <memory>       // for allocator, make_shared, __shared_ptr_access
+#include <optional>     // for optional, nullopt
+#include <string>       // for basic_string, string
+#include <string_view>  // for string_view
+#include <utility>      // for move
+
+#include "ftxui/dom/element_arena.hpp"  // for MakeElement
+#include "ftxui/dom/elements.hpp"       // for unpack, Element, Decorator, BorderStyle, ROUNDED, borderStyled, Elements, DASHED, DOUBLE, EMPTY, HEAVY, LIGHT, border, borderDashed, borderDouble, borderEmpty, borderHeavy, borderLight, borderRounded, borderWith, window
+#include "ftxui/dom/node.hpp"           // for Node, Elements
+#include "ftxui/dom/requirement.hpp"    // for Requirement
+#include "ftxui/screen/box.hpp"         // for Box
+#include "ftxui/screen/pixel.hpp"       // for Pixel
+#include "ftxui/screen/screen.hpp"      // for Pixel, Screen
 
 namespace ftxui {
 
 namespace {
-using Charset = std::array<std::string, 6>;  // NOLINT
+using Charset = std::array<std::string_view, 6>;  // NOLINT
 using Charsets = std::array<Charset, 6>;     // NOLINT
 // NOLINTNEXTLINE
-static Charsets simple_border_charset = {
+constexpr Charsets simple_border_charset = {
     Charset{"┌", "┐", "└", "┘", "─", "│"},  // LIGHT
     Charset{"┏", "┓", "┗", "┛", "╍", "╏"},  // DASHED
     Charset{"┏", "┓", "┗", "┛", "━", "┃"},  // HEAVY
@@ -40,7 +42,9 @@ class Border : public Node {
       : Node(std::move(children)),
         charset_(simple_border_charset[style])  // NOLINT
         ,
-        foreground_color_(foreground_color) {}  // NOLINT
+        foreground_color_(foreground_color) {  // NOLINT
+    cacheable_ = true;
+  }
 
   const Charset& charset_;  // NOLINT
   std::optional<Color> foreground_color_;
@@ -69,13 +73,13 @@ class Border : public Node {
                                  box.x_min + children_[1]->requirement().min_x);
       title_box.y_min = box.y_min;
       title_box.y_max = box.y_min;
-      children_[1]->SetBox(title_box);
+      children_[1]->SetBoxIfDirty(title_box);
     }
     box.x_min++;
     box.x_max--;
     box.y_min++;
     box.y_max--;
-    children_[0]->SetBox(box);
+    children_[0]->SetBoxIfDirty(box);
   }
 
   void Render(Screen& screen) override {
@@ -108,6 +112,9 @@ class Border : public Node {
       p3.automerge = true;
       p4.automerge = true;
     }
+    for (int y = box_.y_min; y <= box_.y_max; ++y) {
+      screen.MarkAutomerge(y);
+    }
 
     // Draw title.
     if (children_.size() == 2) {
@@ -132,7 +139,9 @@ class Border : public Node {
 class BorderPixel : public Node {
  public:
   BorderPixel(Elements children, Pixel pixel)
-      : Node(std::move(children)), pixel_(std::move(pixel)) {}
+      : Node(std::move(children)), pixel_(std::move(pixel)) {
+    cacheable_ = true;
+  }
 
  private:
   Pixel pixel_;
@@ -158,13 +167,13 @@ class BorderPixel : public Node {
       title_box.x_max = box.x_max - 1;
       title_box.y_min = box.y_min;
       title_box.y_max = box.y_min;
-      children_[1]->SetBox(title_box);
+      children_[1]->SetBoxIfDirty(title_box);
     }
     box.x_min++;
     box.x_max--;
     box.y_min++;
     box.y_max--;
-    children_[0]->SetBox(box);
+    children_[0]->SetBoxIfDirty(box);
   }
 
   void Render(Screen& screen) override {
@@ -189,6 +198,11 @@ class BorderPixel : public Node {
       screen.PixelAt(box_.x_min, y) = pixel_;
       screen.PixelAt(box_.x_max, y) = pixel_;
     }
+    if (pixel_.automerge) {
+      for (int y = box_.y_min; y <= box_.y_max; ++y) {
+        screen.MarkAutomerge(y);
+      }
+    }
   }
 };
 }  // namespace
@@ -225,7 +239,7 @@ class BorderPixel : public Node {
 /// └───────────┘
 /// ```
 Element border(Element child) {
-  return std::make_shared<Border>(unpack(std::move(child)), ROUNDED);
+  return MakeElement<Border>(unpack(std::move(child)), ROUNDED);
 }
 
 /// @brief Same as border but with a constant Pixel around the element.
@@ -233,7 +247,7 @@ Element border(Element child) {
 /// @see border
 Decorator borderWith(const Pixel& pixel) {
   return [pixel](Element child) {
-    return std::make_shared<BorderPixel>(unpack(std::move(child)), pixel);
+    return MakeElement<BorderPixel>(unpack(std::move(child)), pixel);
   };
 }
 
@@ -242,7 +256,7 @@ Decorator borderWith(const Pixel& pixel) {
 /// @see border
 Decorator borderStyled(BorderStyle style) {
   return [style](Element child) {
-    return std::make_shared<Border>(unpack(std::move(child)), style);
+    return MakeElement<Border>(unpack(std::move(child)), style);
   };
 }
 
@@ -251,8 +265,8 @@ Decorator borderStyled(BorderStyle style) {
 /// @see border
 Decorator borderStyled(Color foreground_color) {
   return [foreground_color](Element child) {
-    return std::make_shared<Border>(unpack(std::move(child)), ROUNDED,
-                                    foreground_color);
+    return MakeElement<Border>(unpack(std::move(child)), ROUNDED,
+                               foreground_color);
   };
 }
 
@@ -261,8 +275,8 @@ Decorator borderStyled(Color foreground_color) {
 /// @see border
 Decorator borderStyled(BorderStyle style, Color foreground_color) {
   return [style, foreground_color](Element child) {
-    return std::make_shared<Border>(unpack(std::move(child)), style,
-                                    foreground_color);
+    return MakeElement<Border>(unpack(std::move(child)), style,
+                               foreground_color);
   };
 }
 
@@ -298,7 +312,7 @@ Decorator borderStyled(BorderStyle style, Color foreground_color) {
 /// ┗╍╍╍╍╍╍╍╍╍╍╍╍╍╍┛
 /// ```
 Element borderDashed(Element child) {
-  return std::make_shared<Border>(unpack(std::move(child)), DASHED);
+  return MakeElement<Border>(unpack(std::move(child)), DASHED);
 }
 
 /// @brief Draw a light border around the element.
@@ -333,7 +347,7 @@ Element borderDashed(Element child) {
 /// └──────────────┘
 /// ```
 Element borderLight(Element child) {
-  return std::make_shared<Border>(unpack(std::move(child)), LIGHT);
+  return MakeElement<Border>(unpack(std::move(child)), LIGHT);
 }
 
 /// @brief Draw a heavy border around the element.
@@ -368,7 +382,7 @@ Element borderLight(Element child) {
 /// ┗━━━━━━━━━━━━━━┛
 /// ```
 Element borderHeavy(Element child) {
-  return std::make_shared<Border>(unpack(std::move(child)), HEAVY);
+  return MakeElement<Border>(unpack(std::move(child)), HEAVY);
 }
 
 /// @brief Draw a double border around the element.
@@ -403,7 +417,7 @@ Element borderHeavy(Element child) {
 /// ╚══════════════╝
 /// ```
 Element borderDouble(Element child) {
-  return std::make_shared<Border>(unpack(std::move(child)), DOUBLE);
+  return MakeElement<Border>(unpack(std::move(child)), DOUBLE);
 }
 
 /// @brief Draw a rounded border around the element.
@@ -438,7 +452,7 @@ Element borderDouble(Element child) {
 /// ╰──────────────╯
 /// ```
 Element borderRounded(Element child) {
-  return std::make_shared<Border>(unpack(std::move(child)), ROUNDED);
+  return MakeElement<Border>(unpack(std::move(child)), ROUNDED);
 }
 
 /// @brief Draw an empty border around the element.
@@ -473,7 +487,7 @@ Element borderRounded(Element child) {
 ///
 /// ```
 Element borderEmpty(Element child) {
-  return std::make_shared<Border>(unpack(std::move(child)), EMPTY);
+  return MakeElement<Border>(unpack(std::move(child)), EMPTY);
 }
 
 /// @brief Draw window with a title and a border around the element.
@@ -505,7 +519,7 @@ Element borderEmpty(Element child) {
 /// └───────┘
 /// ```
 Element window(Element title, Element content, BorderStyle border) {
-  return std::make_shared<Border>(unpack(std::move(content), std::move(title)),
-                                  border);
+  return MakeElement<Border>(unpack(std::move(content), std::move(title)),
+                             border);
 }
 }  // namespace ftxui
@@ -9,20 +9,22 @@
 #include <cstdlib>                 // for abs
 #include <ftxui/screen/color.hpp>  // for Color
 #include <functional>              // for function
-#include <map>                     // for map
+#include <iterator>                // for size
 #include <memory>                  // for make_shared
+#include <string_view>             // for string_view
 #include <utility>                 // for move, pair
 #include <vector>                  // for vector
 
-#include "ftxui/dom/elements.hpp"     // for Element, canvas
-#include "ftxui/dom/node.hpp"         // for Node
-#include "ftxui/dom/requirement.hpp"  // for Requirement
-#include "ftxui/screen/box.hpp"       // for Box
-#include "ftxui/screen/image.hpp"     // for Image
-#include "ftxui/screen/pixel.hpp"     // for Pixel
-#include "ftxui/screen/screen.hpp"    // for Pixel, Screen
-#include "ftxui/screen/string.hpp"    // for Utf8ToGlyphs
-#include "ftxui/util/ref.hpp"         // for ConstRef
+#include "ftxui/dom/element_arena.hpp"  // for MakeElement
+#include "ftxui/dom/elements.hpp"       // for Element, canvas
+#include "ftxui/dom/node.hpp"           // for Node
+#include "ftxui/dom/requirement.hpp"    // for Requirement
+#include "ftxui/screen/box.hpp"         // for Box
+#include "ftxui/screen/image.hpp"       // for Image
+#include "ftxui/screen/pixel.hpp"       // for Pixel, Grapheme
+#include "ftxui/screen/screen.hpp"      // for Pixel, Screen
+#include "ftxui/screen/string.hpp"      // for Glyphs
+#include "ftxui/util/ref.hpp"           // for ConstRef
 
 namespace ftxui {
 
@@ -67,18 +69,20 @@ uint8_t g_map_braille[2][4][2] = {
 };
 
 // NOLINTNEXTLINE
-std::vector<std::string> g_map_block = {
+constexpr std::string_view g_map_block[16] = {
     " ", "▘", "▖", "▌", "▝", "▀", "▞", "▛",
     "▗", "▚", "▄", "▙", "▐", "▜", "▟", "█",
 };
 
-// NOLINTNEXTLINE
-const std::map<std::string, uint8_t> g_map_block_inversed = {
-    {" ", 0b0000}, {"▘", 0b0001}, {"▖", 0b0010}, {"▌", 0b0011},
-    {"▝", 0b0100}, {"▀", 0b0101}, {"▞", 0b0110}, {"▛", 0b0111},
-    {"▗", 0b1000}, {"▚", 0b1001}, {"▄", 0b1010}, {"▙", 0b1011},
-    {"▐", 0b1100}, {"▜", 0b1101}, {"▟", 0b1110}, {"█", 0b1111},
-};
+// The inverse of g_map_block: the 4 bits drawn by a block character.
+uint8_t MapBlockInversed(const Grapheme& character) {
+  for (uint8_t value = 0; value < std::size(g_map_block); ++value) {
+    if (character == g_map_block[value]) {
+      return value;
+    }
+  }
+  return 0;
+}
 
 constexpr auto nostyle = [](Pixel& /*pixel*/) {};
 
@@ -144,8 +148,10 @@ void Canvas::DrawPointOn(int x, int y) {
     cell.type = CellType::kBraille;
   }
 
-  cell.content.character[1] |= g_map_braille[x % 2][y % 4][0];  // NOLINT
-  cell.content.character[2] |= g_map_braille[x % 2][y % 4][1];  // NOLINT
+  std::string character = cell.content.character;
+  character[1] |= g_map_braille[x % 2][y % 4][0];  // NOLINT
+  character[2] |= g_map_braille[x % 2][y % 4][1];  // NOLINT
+  cell.content.character = character;
 }
 
 /// @brief Erase a braille dot.
@@ -161,8 +167,10 @@ void Canvas::DrawPointOff(int x, int y) {
     cell.type = CellType::kBraille;
   }
 
-  cell.content.character[1] &= ~(g_map_braille[x % 2][y % 4][0]);  // NOLINT
-  cell.content.character[2] &= ~(g_map_braille[x % 2][y % 4][1]);  // NOLINT
+  std::string character = cell.content.character;
+  character[1] &= ~(g_map_braille[x % 2][y % 4][0]);  // NOLINT
+  character[2] &= ~(g_map_braille[x % 2][y % 4][1]);  // NOLINT
+  cell.content.character = character;
 }
 
 /// @brief Toggle a braille dot. A filled one will be erased, and the other will
@@ -179,8 +187,10 @@ void Canvas::DrawPointToggle(int x, int y) {
     cell.type = CellType::kBraille;
   }
 
-  cell.content.character[1] ^= g_map_braille[x % 2][y % 4][0];  // NOLINT
-  cell.content.character[2] ^= g_map_braille[x % 2][y % 4][1];  // NOLINT
+  std::string character = cell.content.character;
+  character[1] ^= g_map_braille[x % 2][y % 4][0];  // NOLINT
+  character[2] ^= g_map_braille[x % 2][y % 4][1];  // NOLINT
+  cell.content.character = character;
 }
 
 /// @brief Draw a line made of braille dots.
@@ -477,7 +487,7 @@ void Canvas::DrawBlockOn(int x, int y) {
   }
 
   const uint8_t bit = (x % 2) * 2 + y % 2;
-  uint8_t value = g_map_block_inversed.at(cell.content.character);
+  uint8_t value = MapBlockInversed(cell.content.character);
   value |= 1U << bit;
   cell.content.character = g_map_block[value];
 }
@@ -497,7 +507,7 @@ void Canvas::DrawBlockOff(int x, int y) {
   y /= 2;
 
   const uint8_t bit = (y % 2) * 2 + x % 2;
-  uint8_t value = g_map_block_inversed.at(cell.content.character);
+  uint8_t value = MapBlockInversed(cell.content.character);
   value &= ~(1U << bit);
   cell.content.character = g_map_block[value];
 }
@@ -518,7 +528,7 @@ void Canvas::DrawBlockToggle(int x, int y) {
   y /= 2;
 
   const uint8_t bit = (y % 2) * 2 + x % 2;
-  uint8_t value = g_map_block_inversed.at(cell.content.character);
+  uint8_t value = MapBlockInversed(cell.content.character);
   value ^= 1U << bit;
   cell.content.character = g_map_block[value];
 }
@@ -807,16 +817,19 @@ void Canvas::DrawText(int x,
                       int y,
                       const std::string& value,
                       const Stylizer& style) {
-  for (const auto& it : Utf8ToGlyphs(value)) {
-    if (!IsIn(x, y)) {
+  for (const Glyph& glyph : Glyphs(value)) {
+    // Fullwidth glyphs take two cells. The second is left empty.
+    for (int i = 0; i < glyph.width; ++i) {
+      if (!IsIn(x, y)) {
+        x += 2;
+        continue;
+      }
+      Cell& cell = storage_[XY{x / 2, y / 4}];
+      cell.type = CellType::kCell;
+      cell.content.character = i == 0 ? glyph.value : "";
+      style(cell.content);
       x += 2;
-      continue;
     }
-    Cell& cell = storage_[XY{x / 2, y / 4}];
-    cell.type = CellType::kCell;
-    cell.content.character = it;
-    style(cell.content);
-    x += 2;
   }
 }
 
@@ -898,7 +911,7 @@ Element canvas(ConstRef<Canvas> canvas) {
     const Canvas& canvas() final { return *canvas_; }
     ConstRef<Canvas> canvas_;
   };
-  return std::make_shared<Impl>(canvas);
+  return MakeElement<Impl>(canvas);
 }
 
 /// @brief Produce an element drawing a canvas of requested size.
@@ -930,7 +943,7 @@ Element canvas(int width, int height, std::function<void(Canvas&)> fn) {
     int height_;
     std::function<void(Canvas&)> fn_;
   };
-  return std::make_shared<Impl>(width, height, std::move(fn));
+  return MakeElement<Impl>(width, height, std::move(fn));
 }
 
 /// @brief Produce an element drawing a canvas.
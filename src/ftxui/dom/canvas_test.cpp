@@ -56,7 +56,7 @@ TEST(CanvasTest, GoldPointColor) {
   });
   Screen screen(30, 10);
   Render(screen, element);
-  EXPECT_EQ(Hash(screen.ToString()), 2295070594U) << screen.ToString();
+  EXPECT_EQ(Hash(screen.ToString()), 1977894242U) << screen.ToString();
 }
 
 TEST(CanvasTest, GoldBlock) {
@@ -89,7 +89,7 @@ TEST(CanvasTest, GoldBlockColor) {
   });
   Screen screen(30, 10);
   Render(screen, element);
-  EXPECT_EQ(Hash(screen.ToString()), 8392696U) << screen.ToString();
+  EXPECT_EQ(Hash(screen.ToString()), 3446212440U) << screen.ToString();
 }
 
 TEST(CanvasTest, GoldText) {
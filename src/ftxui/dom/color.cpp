@@ -4,6 +4,7 @@
 #include <memory>   // for make_shared
 #include <utility>  // for move
 
+#include "ftxui/dom/element_arena.hpp"   // for MakeElement
 #include "ftxui/dom/elements.hpp"  // for Element, Decorator, bgcolor, color
 #include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
 #include "ftxui/screen/box.hpp"          // for Box
@@ -21,14 +22,14 @@ class BgColor : public NodeDecorator {
   void Render(Screen& screen) override {
     if (color_.IsOpaque()) {
       for (int y = box_.y_min; y <= box_.y_max; ++y) {
-        for (int x = box_.x_min; x <= box_.x_max; ++x) {
-          screen.PixelAt(x, y).background_color = color_;
+        for (Pixel& pixel : screen.Row(y, box_.x_min, box_.x_max)) {
+          pixel.background_color = color_;
         }
       }
     } else {
       for (int y = box_.y_min; y <= box_.y_max; ++y) {
-        for (int x = box_.x_min; x <= box_.x_max; ++x) {
-          Color& color = screen.PixelAt(x, y).background_color;
+        for (Pixel& pixel : screen.Row(y, box_.x_min, box_.x_max)) {
+          Color& color = pixel.background_color;
           color = Color::Blend(color, color_);
         }
       }
@@ -47,14 +48,14 @@ class FgColor : public NodeDecorator {
   void Render(Screen& screen) override {
     if (color_.IsOpaque()) {
       for (int y = box_.y_min; y <= box_.y_max; ++y) {
-        for (int x = box_.x_min; x <= box_.x_max; ++x) {
-          screen.PixelAt(x, y).foreground_color = color_;
+        for (Pixel& pixel : screen.Row(y, box_.x_min, box_.x_max)) {
+          pixel.foreground_color = color_;
         }
       }
     } else {
       for (int y = box_.y_min; y <= box_.y_max; ++y) {
-        for (int x = box_.x_min; x <= box_.x_max; ++x) {
-          Color& color = screen.PixelAt(x, y).foreground_color;
+        for (Pixel& pixel : screen.Row(y, box_.x_min, box_.x_max)) {
+          Color& color = pixel.foreground_color;
           color = Color::Blend(color, color_);
         }
       }
@@ -79,7 +80,7 @@ class FgColor : public NodeDecorator {
 /// Element document = color(Color::Green, text("Success")),
 /// ```
 Element color(Color color, Element child) {
-  return std::make_shared<FgColor>(std::move(child), color);
+  return MakeElement<FgColor>(std::move(child), color);
 }
 
 /// @brief Set the background color of an element.
@@ -94,7 +95,7 @@ Element color(Color color, Element child) {
 /// Element document = bgcolor(Color::Green, text("Success")),
 /// ```
 Element bgcolor(Color color, Element child) {
-  return std::make_shared<BgColor>(std::move(child), color);
+  return MakeElement<BgColor>(std::move(child), color);
 }
 
 /// @brief Decorate using a foreground color.
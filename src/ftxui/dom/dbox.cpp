@@ -7,23 +7,26 @@
 #include <utility>    // for move
 #include <vector>
 
-#include "ftxui/dom/elements.hpp"     // for Element, Elements, dbox
-#include "ftxui/dom/node.hpp"         // for Node, Elements
-#include "ftxui/dom/requirement.hpp"  // for Requirement
-#include "ftxui/screen/box.hpp"       // for Box
-#include "ftxui/screen/pixel.hpp"     // for Pixel
+#include "ftxui/dom/element_arena.hpp"  // for MakeElement
+#include "ftxui/dom/elements.hpp"       // for Element, Elements, dbox
+#include "ftxui/dom/node.hpp"           // for Node, Elements
+#include "ftxui/dom/requirement.hpp"    // for Requirement
+#include "ftxui/screen/box.hpp"         // for Box
+#include "ftxui/screen/pixel.hpp"       // for Pixel
 
 namespace ftxui {
 
 namespace {
 class DBox : public Node {
  public:
-  explicit DBox(Elements children) : Node(std::move(children)) {}
+  explicit DBox(Elements children) : Node(std::move(children)) {
+    cacheable_ = true;
+  }
 
   void ComputeRequirement() override {
     requirement_ = Requirement{};
     for (auto& child : children_) {
-      child->ComputeRequirement();
+      child->ComputeRequirementIfDirty();
 
       // Propagate the focused requirement.
       if (requirement_.focused.Prefer(child->requirement().focused)) {
@@ -42,7 +45,7 @@ class DBox : public Node {
     Node::SetBox(box);
 
     for (auto& child : children_) {
-      child->SetBox(box);
+      child->SetBoxIfDirty(box);
     }
   }
 };
@@ -53,7 +56,7 @@ class DBox : public Node {
 /// @return The right aligned element.
 /// @ingroup dom
 Element dbox(Elements children_) {
-  return std::make_shared<DBox>(std::move(children_));
+  return MakeElement<DBox>(std::move(children_));
 }
 
 }  // namespace ftxui
@@ -4,6 +4,7 @@
 #include <memory>   // for make_shared
 #include <utility>  // for move
 
+#include "ftxui/dom/element_arena.hpp"   // for MakeElement
 #include "ftxui/dom/elements.hpp"        // for Element, dim
 #include "ftxui/dom/node.hpp"            // for Node
 #include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
@@ -20,8 +21,8 @@ class Dim : public NodeDecorator {
   void Render(Screen& screen) override {
     Node::Render(screen);
     for (int y = box_.y_min; y <= box_.y_max; ++y) {
-      for (int x = box_.x_min; x <= box_.x_max; ++x) {
-        screen.PixelAt(x, y).dim = true;
+      for (Pixel& pixel : screen.Row(y, box_.x_min, box_.x_max)) {
+        pixel.dim = true;
       }
     }
   }
@@ -31,7 +32,7 @@ class Dim : public NodeDecorator {
 /// @brief Use a light font, for elements with less emphasis.
 /// @ingroup dom
 Element dim(Element child) {
-  return std::make_shared<Dim>(std::move(child));
+  return MakeElement<Dim>(std::move(child));
 }
 
 }  // namespace ftxui
@@ -0,0 +1,143 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/dom/element_arena.hpp"
+
+#include <algorithm>  // for max
+#include <cassert>    // for assert
+#include <cstddef>    // for size_t, byte, max_align_t
+#include <memory>     // for make_shared, make_unique, shared_ptr, unique_ptr
+#include <vector>     // for vector
+
+namespace ftxui {
+
+namespace {
+
+// Large enough for the elements of a small frame.
+constexpr size_t kFirstBlockSize = 64 * 1024;
+
+thread_local ElementArena* g_current = nullptr;  // NOLINT
+
+size_t AlignUp(size_t offset, size_t alignment) {
+  return (offset + alignment - 1) / alignment * alignment;
+}
+
+struct Block {
+  std::unique_ptr<std::byte[]> data;  // NOLINT
+  size_t size = 0;
+};
+
+Block MakeBlock(size_t size) {
+  Block block;
+  block.size = size;
+  block.data = std::make_unique<std::byte[]>(size);  // NOLINT
+  return block;
+}
+
+}  // namespace
+
+struct ElementArena::Pool {
+  std::vector<Block> blocks;
+  size_t block = 0;   // The block being filled.
+  size_t offset = 0;  // The first free byte in this block.
+  size_t size = 0;
+  size_t live = 0;
+};
+
+ElementArena::ElementArena() : pool_(std::make_shared<Pool>()) {}
+
+// The allocations still alive keep the pool.
+ElementArena::~ElementArena() = default;
+
+ElementArena::Scope::Scope(ElementArena* arena) : previous_(g_current) {
+  g_current = arena;
+}
+
+ElementArena::Scope::~Scope() {
+  g_current = previous_;
+}
+
+// static
+ElementArena* ElementArena::Current() {
+  return g_current;
+}
+
+void* ElementArena::Allocate(size_t size, size_t alignment) {
+  return Allocate(*pool_, size, alignment);
+}
+
+void ElementArena::Deallocate(void* pointer) {
+  Deallocate(*pool_, pointer);
+}
+
+size_t ElementArena::size() const {
+  return pool_->size;
+}
+
+size_t ElementArena::live() const {
+  return pool_->live;
+}
+
+// static
+void* ElementArena::Allocate(Pool& pool, size_t size, size_t alignment) {
+  assert(alignment <= alignof(std::max_align_t));  // NOLINT
+  pool.size += size;
+  ++pool.live;
+
+  // Fill the current block, then the next ones kept from the previous frames.
+  while (pool.block < pool.blocks.size()) {
+    Block& block = pool.blocks[pool.block];
+    const size_t offset = AlignUp(pool.offset, alignment);
+    if (offset + size <= block.size) {
+      pool.offset = offset + size;
+      return block.data.get() + offset;
+    }
+    ++pool.block;
+    pool.offset = 0;
+  }
+
+  // Grow geometrically. The memory returned by operator new is aligned for
+  // every fundamental type.
+  const size_t previous = pool.blocks.empty() ? 0 : pool.blocks.back().size;
+  pool.blocks.push_back(
+      MakeBlock(std::max({kFirstBlockSize, size, 2 * previous})));
+  pool.block = pool.blocks.size() - 1;
+  pool.offset = size;
+  return pool.blocks.back().data.get();
+}
+
+// static
+void ElementArena::Deallocate(Pool& pool, void* /*pointer*/) {
+  assert(pool.live != 0);  // NOLINT
+  --pool.live;
+}
+
+void ElementArena::Release() {
+  size_t total = 0;
+  for (const Block& block : pool_->blocks) {
+    total += block.size;
+  }
+
+  // Some elements outlive the frame. Reusing the memory would overwrite them.
+  // Leave it to them, it is freed with the last one. The next frames are
+  // allocated from a new pool.
+  if (pool_->live != 0) {
+    pool_ = std::make_shared<Pool>();
+    if (total != 0) {
+      pool_->blocks.push_back(MakeBlock(total));
+    }
+    return;
+  }
+
+  // Merge the blocks, so that the next frames of the same size fit in a single
+  // one.
+  if (pool_->blocks.size() > 1) {
+    pool_->blocks.clear();
+    pool_->blocks.push_back(MakeBlock(total));
+  }
+  pool_->block = 0;
+  pool_->offset = 0;
+  pool_->size = 0;
+}
+
+}  // namespace ftxui
@@ -0,0 +1,155 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <cstddef>  // for max_align_t
+#include <cstdint>  // for uintptr_t
+#include <memory>   // for make_unique
+#include <string>   // for to_string
+
+#include "ftxui/dom/element_arena.hpp"  // for ElementArena
+#include "ftxui/dom/elements.hpp"       // for text, vbox, border, Element
+#include "ftxui/dom/node.hpp"           // for Render
+#include "ftxui/screen/screen.hpp"      // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+TEST(ElementArenaTest, AllocateFromScope) {
+  ElementArena arena;
+  auto outside = text("outside");
+  EXPECT_EQ(arena.size(), 0u);
+
+  {
+    ElementArena::Scope scope(&arena);
+    auto document = vbox({text("Hello"), text("World")}) | border;
+    EXPECT_GT(arena.size(), 0u);
+
+    Screen screen(7, 4);
+    Render(screen, document);
+    EXPECT_EQ(screen.ToString(),
+              "╭─────╮\r\n"
+              "│Hello│\r\n"
+              "│World│\r\n"
+              "╰─────╯");
+  }
+
+  const size_t size = arena.size();
+  auto after = text("after");
+  EXPECT_EQ(arena.size(), size);
+}
+
+TEST(ElementArenaTest, NestedScopes) {
+  ElementArena first;
+  ElementArena second;
+  EXPECT_EQ(ElementArena::Current(), nullptr);
+  {
+    ElementArena::Scope first_scope(&first);
+    EXPECT_EQ(ElementArena::Current(), &first);
+    {
+      ElementArena::Scope second_scope(&second);
+      EXPECT_EQ(ElementArena::Current(), &second);
+      {
+        ElementArena::Scope heap_scope(nullptr);
+        EXPECT_EQ(ElementArena::Current(), nullptr);
+      }
+      EXPECT_EQ(ElementArena::Current(), &second);
+    }
+    EXPECT_EQ(ElementArena::Current(), &first);
+  }
+  EXPECT_EQ(ElementArena::Current(), nullptr);
+}
+
+TEST(ElementArenaTest, ReleaseAndReuse) {
+  ElementArena arena;
+  for (int frame = 0; frame < 3; ++frame) {
+    {
+      ElementArena::Scope scope(&arena);
+      Elements lines;
+      for (int i = 0; i < 10000; ++i) {
+        lines.push_back(text(std::to_string(i)));
+      }
+      auto document = vbox(std::move(lines));
+      Screen screen(5, 2);
+      Render(screen, document);
+      EXPECT_EQ(screen.ToString(), "0    \r\n1    ");
+    }
+    EXPECT_GT(arena.size(), 0u);
+    arena.Release();
+    EXPECT_EQ(arena.size(), 0u);
+  }
+}
+
+TEST(ElementArenaTest, LiveAllocations) {
+  ElementArena arena;
+  {
+    ElementArena::Scope scope(&arena);
+    auto document = vbox({text("Hello"), text("World")});
+    EXPECT_EQ(arena.live(), 3u);
+    {
+      auto copy = document;
+      EXPECT_EQ(arena.live(), 3u);
+    }
+    document = nullptr;
+    EXPECT_EQ(arena.live(), 0u);
+
+    auto kept = text("kept");
+    EXPECT_EQ(arena.live(), 1u);
+  }
+  EXPECT_EQ(arena.live(), 0u);
+  arena.Release();
+}
+
+TEST(ElementArenaTest, Alignment) {
+  ElementArena arena;
+  for (size_t alignment = 1; alignment <= alignof(std::max_align_t);
+       alignment *= 2) {
+    for (size_t size : {1, 3, 8, 100000}) {
+      void* pointer = arena.Allocate(size, alignment);
+      EXPECT_EQ(reinterpret_cast<uintptr_t>(pointer) % alignment, 0u);
+    }
+  }
+}
+
+TEST(ElementArenaTest, ElementOutlivesFrame) {
+  Element kept;
+  ElementArena arena;
+  for (int frame = 0; frame < 3; ++frame) {
+    ElementArena::Scope scope(&arena);
+    Elements lines;
+    for (int i = 0; i < 1000; ++i) {
+      lines.push_back(text(std::to_string(frame)));
+    }
+    auto document = vbox(std::move(lines));
+    if (frame == 0) {
+      kept = document;
+    }
+    document = nullptr;
+    lines.clear();
+    EXPECT_EQ(arena.live(), frame == 0 ? 1001u : 0u);
+    arena.Release();
+    EXPECT_EQ(arena.live(), 0u);
+  }
+
+  // The memory of the first frame wasn't reused.
+  Screen screen(1, 1);
+  Render(screen, kept);
+  EXPECT_EQ(screen.ToString(), "0");
+}
+
+TEST(ElementArenaTest, ElementOutlivesArena) {
+  Element kept;
+  {
+    auto arena = std::make_unique<ElementArena>();
+    ElementArena::Scope scope(arena.get());
+    kept = text("kept");
+    arena.reset();
+  }
+  Screen screen(4, 1);
+  Render(screen, kept);
+  EXPECT_EQ(screen.ToString(), "kept");
+  kept = nullptr;
+}
+
+}  // namespace ftxui
+// NOLINTEND
@@ -57,9 +57,13 @@ export namespace ftxui {
     using ftxui::paragraphAlignRight;
     using ftxui::paragraphAlignCenter;
     using ftxui::paragraphAlignJustify;
+    using ftxui::styledParagraph;
+    using ftxui::ansiParagraph;
     using ftxui::graph;
     using ftxui::emptyElement;
     using ftxui::canvas;
+    using ftxui::styledText;
+    using ftxui::ansiText;
 
     using ftxui::bold;
     using ftxui::dim;
@@ -110,6 +114,7 @@ export namespace ftxui {
     using ftxui::yframe;
     using ftxui::focus;
     using ftxui::select;
+    using ftxui::virtualList;
 
     using ftxui::focusCursorBlock;
     using ftxui::focusCursorBlockBlinking;
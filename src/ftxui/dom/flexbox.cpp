@@ -8,7 +8,8 @@
 #include <utility>  // for move, swap
 #include <vector>   // for vector
 
-#include "ftxui/dom/elements.hpp"  // for Element, Elements, flexbox, hflow, vflow
+#include "ftxui/dom/element_arena.hpp"   // for MakeElement
+#include "ftxui/dom/elements.hpp"        // for Element, Elements, flexbox, hflow, vflow
 #include "ftxui/dom/flexbox_config.hpp"  // for FlexboxConfig, FlexboxConfig::Direction, FlexboxConfig::Direction::Column, FlexboxConfig::AlignContent, FlexboxConfig::Direction::ColumnInversed, FlexboxConfig::Direction::Row, FlexboxConfig::JustifyContent, FlexboxConfig::Wrap, FlexboxConfig::AlignContent::FlexStart, FlexboxConfig::Direction::RowInversed, FlexboxConfig::JustifyContent::FlexStart, FlexboxConfig::Wrap::Wrap
 #include "ftxui/dom/flexbox_helper.hpp"  // for Block, Global, Compute
 #include "ftxui/dom/node.hpp"            // for Node, Elements, Node::Status
@@ -93,7 +94,7 @@ class Flexbox : public Node {
   void ComputeRequirement() override {
     requirement_ = Requirement{};
     for (auto& child : children_) {
-      child->ComputeRequirement();
+      child->ComputeRequirementIfDirty();
     }
     global_ = flexbox_helper::Global();
     global_.config = config_normalized_;
@@ -163,7 +164,7 @@ class Flexbox : public Node {
       children_box.y_max = box.y_min + b.y + b.dim_y - 1;
 
       const Box intersection = Box::Intersection(children_box, box);
-      child->SetBox(intersection);
+      child->SetBoxIfDirty(intersection);
 
       need_iteration_ |= (intersection != children_box);
     }
@@ -208,7 +209,7 @@ class Flexbox : public Node {
 
   void Check(Status* status) override {
     for (auto& child : children_) {
-      child->Check(status);
+      child->CheckIfDirty(status);
     }
 
     if (status->iteration == 0) {
@@ -249,7 +250,7 @@ class Flexbox : public Node {
 /// )
 /// ```
 Element flexbox(Elements children, FlexboxConfig config) {
-  return std::make_shared<Flexbox>(std::move(children), config);
+  return MakeElement<Flexbox>(std::move(children), config);
 }
 
 /// @brief A container displaying elements in rows from left to right. When
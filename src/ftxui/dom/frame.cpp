@@ -5,19 +5,23 @@
 #include <memory>     // for make_shared, __shared_ptr_access
 #include <utility>    // for move
 
-#include "ftxui/dom/elements.hpp"  // for Element, unpack, Elements, focus, frame, select, xframe, yframe
-#include "ftxui/dom/node.hpp"         // for Node, Elements
-#include "ftxui/dom/requirement.hpp"  // for Requirement
-#include "ftxui/screen/box.hpp"       // for Box
-#include "ftxui/screen/screen.hpp"    // for Screen, Screen::Cursor
-#include "ftxui/util/autoreset.hpp"   // for AutoReset
+#include "ftxui/dom/element_arena.hpp"  // for MakeElement
+#include "ftxui/dom/elements.hpp"       // for Element, unpack, Elements, focus, frame, select, xframe, yframe
+#include "ftxui/dom/node.hpp"           // for Node, Elements
+#include "ftxui/dom/requirement.hpp"    // for Requirement
+#include "ftxui/dom/viewport.hpp"       // for Visible
+#include "ftxui/screen/box.hpp"         // for Box
+#include "ftxui/screen/screen.hpp"      // for Screen, Screen::Cursor
+#include "ftxui/util/autoreset.hpp"     // for AutoReset
 
 namespace ftxui {
 
 namespace {
 class Focus : public Node {
  public:
-  explicit Focus(Elements children) : Node(std::move(children)) {}
+  explicit Focus(Elements children) : Node(std::move(children)) {
+    cacheable_ = true;
+  }
 
   void ComputeRequirement() override {
     Node::ComputeRequirement();
@@ -32,14 +36,16 @@ class Focus : public Node {
 
   void SetBox(Box box) override {
     Node::SetBox(box);
-    children_[0]->SetBox(box);
+    children_[0]->SetBoxIfDirty(box);
   }
 };
 
 class Frame : public Node {
  public:
   Frame(Elements children, bool x_frame, bool y_frame)
-      : Node(std::move(children)), x_frame_(x_frame), y_frame_(y_frame) {}
+      : Node(std::move(children)), x_frame_(x_frame), y_frame_(y_frame) {
+    cacheable_ = true;
+  }
 
   void SetBox(Box box) override {
     Node::SetBox(box);
@@ -66,7 +72,10 @@ class Frame : public Node {
       children_box.y_max = box.y_min + internal_dimy - dy;
     }
 
-    children_[0]->SetBox(children_box);
+    // Only the part of the children inside of the frame is visible.
+    const AutoReset<Box> visible(
+        &viewport::Visible(), Box::Intersection(box, viewport::Visible()));
+    children_[0]->SetBoxIfDirty(children_box);
   }
 
   void Render(Screen& screen) override {
@@ -99,7 +108,7 @@ class FocusCursor : public Focus {
 /// @param child The element to be focused.
 /// @ingroup dom
 Element focus(Element child) {
-  return std::make_shared<Focus>(unpack(std::move(child)));
+  return MakeElement<Focus>(unpack(std::move(child)));
 }
 
 /// This is deprecated. Use `focus` instead.
@@ -116,7 +125,7 @@ Element select(Element child) {
 /// @see xframe
 /// @see yframe
 Element frame(Element child) {
-  return std::make_shared<Frame>(unpack(std::move(child)), true, true);
+  return MakeElement<Frame>(unpack(std::move(child)), true, true);
 }
 
 /// @brief Same as `frame`, but only on the x-axis.
@@ -124,7 +133,7 @@ Element frame(Element child) {
 /// @see xframe
 /// @see yframe
 Element xframe(Element child) {
-  return std::make_shared<Frame>(unpack(std::move(child)), true, false);
+  return MakeElement<Frame>(unpack(std::move(child)), true, false);
 }
 
 /// @brief Same as `frame`, but only on the y-axis.
@@ -132,7 +141,7 @@ Element xframe(Element child) {
 /// @see xframe
 /// @see yframe
 Element yframe(Element child) {
-  return std::make_shared<Frame>(unpack(std::move(child)), false, true);
+  return MakeElement<Frame>(unpack(std::move(child)), false, true);
 }
 
 /// @brief Same as `focus`, but set the cursor shape to be a still block.
@@ -145,8 +154,8 @@ Element yframe(Element child) {
 /// @see focusCursorUnderlineBlinking
 /// @ingroup dom
 Element focusCursorBlock(Element child) {
-  return std::make_shared<FocusCursor>(unpack(std::move(child)),
-                                       Screen::Cursor::Block);
+  return MakeElement<FocusCursor>(unpack(std::move(child)),
+                                  Screen::Cursor::Block);
 }
 
 /// @brief Same as `focus`, but set the cursor shape to be a blinking block.
@@ -159,8 +168,8 @@ Element focusCursorBlock(Element child) {
 /// @see focusCursorUnderlineBlinking
 /// @ingroup dom
 Element focusCursorBlockBlinking(Element child) {
-  return std::make_shared<FocusCursor>(unpack(std::move(child)),
-                                       Screen::Cursor::BlockBlinking);
+  return MakeElement<FocusCursor>(unpack(std::move(child)),
+                                  Screen::Cursor::BlockBlinking);
 }
 
 /// @brief Same as `focus`, but set the cursor shape to be a still block.
@@ -173,8 +182,8 @@ Element focusCursorBlockBlinking(Element child) {
 /// @see focusCursorUnderlineBlinking
 /// @ingroup dom
 Element focusCursorBar(Element child) {
-  return std::make_shared<FocusCursor>(unpack(std::move(child)),
-                                       Screen::Cursor::Bar);
+  return MakeElement<FocusCursor>(unpack(std::move(child)),
+                                  Screen::Cursor::Bar);
 }
 
 /// @brief Same as `focus`, but set the cursor shape to be a blinking bar.
@@ -187,8 +196,8 @@ Element focusCursorBar(Element child) {
 /// @see focusCursorUnderlineBlinking
 /// @ingroup dom
 Element focusCursorBarBlinking(Element child) {
-  return std::make_shared<FocusCursor>(unpack(std::move(child)),
-                                       Screen::Cursor::BarBlinking);
+  return MakeElement<FocusCursor>(unpack(std::move(child)),
+                                  Screen::Cursor::BarBlinking);
 }
 
 /// @brief Same as `focus`, but set the cursor shape to be a still underline.
@@ -201,8 +210,8 @@ Element focusCursorBarBlinking(Element child) {
 /// @see focusCursorUnderlineBlinking
 /// @ingroup dom
 Element focusCursorUnderline(Element child) {
-  return std::make_shared<FocusCursor>(unpack(std::move(child)),
-                                       Screen::Cursor::Underline);
+  return MakeElement<FocusCursor>(unpack(std::move(child)),
+                                  Screen::Cursor::Underline);
 }
 
 /// @brief Same as `focus`, but set the cursor shape to be a blinking underline.
@@ -215,8 +224,8 @@ Element focusCursorUnderline(Element child) {
 /// @see focusCursorUnderlineBlinking
 /// @ingroup dom
 Element focusCursorUnderlineBlinking(Element child) {
-  return std::make_shared<FocusCursor>(unpack(std::move(child)),
-                                       Screen::Cursor::UnderlineBlinking);
+  return MakeElement<FocusCursor>(unpack(std::move(child)),
+                                  Screen::Cursor::UnderlineBlinking);
 }
 
 }  // namespace ftxui
@@ -4,18 +4,20 @@
 #include <ftxui/dom/direction.hpp>  // for Direction, Direction::Down, Direction::Left, Direction::Right, Direction::Up
 #include <memory>                   // for allocator, make_shared
 #include <string>                   // for string
+#include <string_view>              // for string_view
 
-#include "ftxui/dom/elements.hpp"  // for Element, gauge, gaugeDirection, gaugeDown, gaugeLeft, gaugeRight, gaugeUp
-#include "ftxui/dom/node.hpp"         // for Node
-#include "ftxui/dom/requirement.hpp"  // for Requirement
-#include "ftxui/screen/box.hpp"       // for Box
-#include "ftxui/screen/screen.hpp"    // for Screen, Pixel
+#include "ftxui/dom/element_arena.hpp"  // for MakeElement
+#include "ftxui/dom/elements.hpp"       // for Element, gauge, gaugeDirection, gaugeDown, gaugeLeft, gaugeRight, gaugeUp
+#include "ftxui/dom/node.hpp"           // for Node
+#include "ftxui/dom/requirement.hpp"    // for Requirement
+#include "ftxui/screen/box.hpp"         // for Box
+#include "ftxui/screen/screen.hpp"      // for Screen, Pixel
 
 namespace ftxui {
 
 namespace {
 // NOLINTNEXTLINE
-static const std::string charset_horizontal[11] = {
+constexpr std::string_view charset_horizontal[11] = {
 #if defined(FTXUI_MICROSOFT_TERMINAL_FALLBACK)
     // Microsoft's terminals often use fonts not handling the 8 unicode
     // characters for representing the whole gauge. Fallback with less.
@@ -28,7 +30,7 @@ static const std::string charset_horizontal[11] = {
     "█"};
 
 // NOLINTNEXTLINE
-static const std::string charset_vertical[10] = {
+constexpr std::string_view charset_vertical[10] = {
     "█",
     "▇",
     "▆",
@@ -54,6 +56,7 @@ class Gauge : public Node {
     if (!(progress_ < 1.F)) {
       progress_ = 1.F;
     }
+    cacheable_ = true;
   }
 
   void ComputeRequirement() override {
@@ -167,7 +170,7 @@ class Gauge : public Node {
 /// @param direction Direction of progress bars progression.
 /// @ingroup dom
 Element gaugeDirection(float progress, Direction direction) {
-  return std::make_shared<Gauge>(progress, direction);
+  return MakeElement<Gauge>(progress, direction);
 }
 
 /// @brief Draw a high definition progress bar progressing from left to right.
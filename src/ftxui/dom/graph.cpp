@@ -1,23 +1,25 @@
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
-#include <functional>  // for function
-#include <memory>      // for allocator, make_shared
-#include <string>      // for string
-#include <utility>     // for move
-#include <vector>      // for vector
+#include <functional>   // for function
+#include <memory>       // for allocator, make_shared
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <utility>      // for move
+#include <vector>       // for vector
 
-#include "ftxui/dom/elements.hpp"     // for GraphFunction, Element, graph
-#include "ftxui/dom/node.hpp"         // for Node
-#include "ftxui/dom/requirement.hpp"  // for Requirement
-#include "ftxui/screen/box.hpp"       // for Box
-#include "ftxui/screen/screen.hpp"    // for Screen
+#include "ftxui/dom/element_arena.hpp"  // for MakeElement
+#include "ftxui/dom/elements.hpp"       // for GraphFunction, Element, graph
+#include "ftxui/dom/node.hpp"           // for Node
+#include "ftxui/dom/requirement.hpp"    // for Requirement
+#include "ftxui/screen/box.hpp"         // for Box
+#include "ftxui/screen/screen.hpp"      // for Screen
 
 namespace ftxui {
 
 namespace {
 // NOLINTNEXTLINE
-static std::string charset[] =
+constexpr std::string_view charset[] =
 #if defined(FTXUI_MICROSOFT_TERMINAL_FALLBACK)
     // Microsoft's terminals often use fonts not handling the 8 unicode
     // characters for representing the whole graph. Fallback with less.
@@ -29,7 +31,9 @@ static std::string charset[] =
 class Graph : public Node {
  public:
   explicit Graph(GraphFunction graph_function)
-      : graph_function_(std::move(graph_function)) {}
+      : graph_function_(std::move(graph_function)) {
+    cacheable_ = true;
+  }
 
   void ComputeRequirement() override {
     requirement_.flex_grow_x = 1;
@@ -69,7 +73,7 @@ class Graph : public Node {
 /// @brief Draw a graph using a GraphFunction.
 /// @param graph_function the function to be called to get the data.
 Element graph(GraphFunction graph_function) {
-  return std::make_shared<Graph>(std::move(graph_function));
+  return MakeElement<Graph>(std::move(graph_function));
 }
 
 }  // namespace ftxui
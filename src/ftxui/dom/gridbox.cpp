@@ -7,11 +7,12 @@
 #include <utility>  // for move
 #include <vector>   // for vector, __alloc_traits<>::value_type
 
-#include "ftxui/dom/box_helper.hpp"   // for Element, Compute
+#include "ftxui/dom/box_helper.hpp"     // for Element, Compute
+#include "ftxui/dom/element_arena.hpp"  // for MakeElement
 #include "ftxui/dom/elements.hpp"     // for Elements, filler, Element, gridbox
-#include "ftxui/dom/node.hpp"         // for Node
-#include "ftxui/dom/requirement.hpp"  // for Requirement
-#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/dom/node.hpp"           // for Node
+#include "ftxui/dom/requirement.hpp"    // for Requirement
+#include "ftxui/screen/box.hpp"         // for Box
 
 namespace ftxui {
 class Screen;
@@ -52,7 +53,7 @@ class GridBox : public Node {
     requirement_ = Requirement{};
     for (auto& line : lines_) {
       for (auto& cell : line) {
-        cell->ComputeRequirement();
+        cell->ComputeRequirementIfDirty();
       }
     }
 
@@ -125,7 +126,7 @@ class GridBox : public Node {
         box_x.x_min = x;
         x += elements_x[ix].size;
         box_x.x_max = x - 1;
-        lines_[iy][ix]->SetBox(box_x);
+        lines_[iy][ix]->SetBoxIfDirty(box_x);
       }
     }
   }
@@ -171,7 +172,7 @@ class GridBox : public Node {
 /// ╰──────────╯╰──────╯╰──────────╯
 /// ```
 Element gridbox(std::vector<Elements> lines) {
-  return std::make_shared<GridBox>(std::move(lines));
+  return MakeElement<GridBox>(std::move(lines));
 }
 
 }  // namespace ftxui
@@ -4,33 +4,42 @@
 #include <algorithm>  // for max
 #include <cstddef>    // for size_t
 #include <memory>  // for __shared_ptr_access, shared_ptr, make_shared, allocator_traits<>::value_type
+#include <string>   // for string
 #include <utility>  // for move
 #include <vector>   // for vector, __alloc_traits<>::value_type
 
-#include "ftxui/dom/box_helper.hpp"   // for Element, Compute
-#include "ftxui/dom/elements.hpp"     // for Element, Elements, hbox
-#include "ftxui/dom/node.hpp"         // for Node, Elements
-#include "ftxui/dom/requirement.hpp"  // for Requirement
-#include "ftxui/dom/selection.hpp"    // for Selection
-#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/dom/box_helper.hpp"     // for Element, Compute
+#include "ftxui/dom/element_arena.hpp"  // for MakeElement
+#include "ftxui/dom/elements.hpp"       // for Element, Elements, hbox
+#include "ftxui/dom/node.hpp"           // for Node, Elements
+#include "ftxui/dom/requirement.hpp"    // for Requirement
+#include "ftxui/dom/selection.hpp"      // for Selection
+#include "ftxui/dom/viewport.hpp"       // for LaidOut, Visible
+#include "ftxui/screen/box.hpp"         // for Box
+#include "ftxui/screen/screen.hpp"      // for Screen
 namespace ftxui {
 
 namespace {
 class HBox : public Node {
  public:
-  explicit HBox(Elements children) : Node(std::move(children)) {}
+  explicit HBox(Elements children) : Node(std::move(children)) {
+    cacheable_ = true;
+  }
 
  private:
   void ComputeRequirement() override {
     requirement_ = Requirement{};
+    focused_child_ = viewport::LaidOut::kNone;
 
-    for (auto& child : children_) {
-      child->ComputeRequirement();
+    for (size_t i = 0; i < children_.size(); ++i) {
+      auto& child = children_[i];
+      child->ComputeRequirementIfDirty();
 
       // Propagate the focused requirement.
       if (requirement_.focused.Prefer(child->requirement().focused)) {
         requirement_.focused = child->requirement().focused;
         requirement_.focused.box.Shift(requirement_.min_x, 0);
+        focused_child_ = i;
       }
 
       // Extend the min_x and min_y to contain all the children
@@ -54,15 +63,38 @@ class HBox : public Node {
     const int target_size = box.x_max - box.x_min + 1;
     box_helper::Compute(&elements, target_size);
 
+    // Skip the children outside of the screen. The visible ones are contiguous.
+    // The empty ones are kept where they are placed, as they may grow.
+    const Box& visible = viewport::Visible();
+    laid_out_ = {};
     int x = box.x_min;
     for (size_t i = 0; i < children_.size(); ++i) {
       box.x_min = x;
       box.x_max = x + elements[i].size - 1;
-      children_[i]->SetBox(box);
       x = box.x_max + 1;
+      if (std::max(box.x_min, box.x_max) >= visible.x_min &&
+          box.x_min <= visible.x_max) {
+        laid_out_.Add(i);
+      } else if (i == focused_child_) {
+        laid_out_.focused = i;
+      } else {
+        continue;
+      }
+      children_[i]->SetBoxIfDirty(box);
     }
   }
 
+  void Check(Status* status) override {
+    laid_out_.ForEach(children_,
+                      [&](const Element& child) { child->CheckIfDirty(status); });
+    status->need_iteration |= (status->iteration == 0);
+  }
+
+  void Render(Screen& screen) override {
+    laid_out_.ForEach(children_,
+                      [&](const Element& child) { child->Render(screen); });
+  }
+
   void Select(Selection& selection) override {
     // If this Node box_ doesn't intersect with the selection, then no
     // selection.
@@ -71,10 +103,21 @@ class HBox : public Node {
     }
 
     Selection selection_saturated = selection.SaturateHorizontal(box_);
-    for (auto& child : children_) {
+    laid_out_.ForEach(children_, [&](const Element& child) {
       child->Select(selection_saturated);
-    }
+    });
   }
+
+  std::string GetSelectedContent(Selection& selection) override {
+    std::string content;
+    laid_out_.ForEach(children_, [&](const Element& child) {
+      content += child->GetSelectedContent(selection);
+    });
+    return content;
+  }
+
+  size_t focused_child_ = viewport::LaidOut::kNone;
+  viewport::LaidOut laid_out_;
 };
 
 }  // namespace
@@ -92,7 +135,7 @@ class HBox : public Node {
 /// });
 /// ```
 Element hbox(Elements children) {
-  return std::make_shared<HBox>(std::move(children));
+  return MakeElement<HBox>(std::move(children));
 }
 
 }  // namespace ftxui
@@ -6,6 +6,7 @@
 #include <string>   // for string
 #include <utility>  // for move
 
+#include "ftxui/dom/element_arena.hpp"   // for MakeElement
 #include "ftxui/dom/elements.hpp"        // for Element, Decorator, hyperlink
 #include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
 #include "ftxui/screen/box.hpp"          // for Box
@@ -20,10 +21,10 @@ class Hyperlink : public NodeDecorator {
       : NodeDecorator(std::move(child)), link_(std::move(link)) {}
 
   void Render(Screen& screen) override {
-    const uint8_t hyperlink_id = screen.RegisterHyperlink(link_);
+    const uint16_t hyperlink_id = screen.RegisterHyperlink(link_);
     for (int y = box_.y_min; y <= box_.y_max; ++y) {
-      for (int x = box_.x_min; x <= box_.x_max; ++x) {
-        screen.PixelAt(x, y).hyperlink = hyperlink_id;
+      for (Pixel& pixel : screen.Row(y, box_.x_min, box_.x_max)) {
+        pixel.hyperlink = hyperlink_id;
       }
     }
     NodeDecorator::Render(screen);
@@ -49,7 +50,7 @@ class Hyperlink : public NodeDecorator {
 ///   hyperlink("https://github.com/ArthurSonzogni/FTXUI", "link");
 /// ```
 Element hyperlink(std::string link, Element child) {
-  return std::make_shared<Hyperlink>(std::move(child), std::move(link));
+  return MakeElement<Hyperlink>(std::move(child), std::move(link));
 }
 
 /// @brief Decorate using a hyperlink.
@@ -10,11 +10,12 @@
 #include <utility>   // for move
 #include <vector>    // for vector
 
+#include "ftxui/dom/element_arena.hpp"   // for MakeElement
 #include "ftxui/dom/elements.hpp"  // for Element, Decorator, bgcolor, color
 #include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
 #include "ftxui/screen/box.hpp"          // for Box
 #include "ftxui/screen/color.hpp"   // for Color, Color::Default, Color::Blue
-#include "ftxui/screen/screen.hpp"  // for Pixel, Screen
+#include "ftxui/screen/screen.hpp"       // for Pixel, Screen
 
 namespace ftxui {
 namespace {
@@ -243,8 +244,8 @@ LinearGradient& LinearGradient::Stop(Color c) {
 /// color(LinearGradient{0, {Color::Red, Color::Blue}}, text("Hello"))
 /// ```
 Element color(const LinearGradient& gradient, Element child) {
-  return std::make_shared<LinearGradientColor>(std::move(child), gradient,
-                                               /*background_color*/ false);
+  return MakeElement<LinearGradientColor>(std::move(child), gradient,
+                                          /*background_color*/ false);
 }
 
 /// @brief Set the background color of an element with linear-gradient effect.
@@ -259,8 +260,8 @@ Element color(const LinearGradient& gradient, Element child) {
 /// bgcolor(LinearGradient{0, {Color::Red, Color::Blue}}, text("Hello"))
 /// ```
 Element bgcolor(const LinearGradient& gradient, Element child) {
-  return std::make_shared<LinearGradientColor>(std::move(child), gradient,
-                                               /*background_color*/ true);
+  return MakeElement<LinearGradientColor>(std::move(child), gradient,
+                                          /*background_color*/ true);
 }
 
 /// @brief Decorate using a linear-gradient effect on the foreground color.
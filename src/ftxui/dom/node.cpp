@@ -7,14 +7,37 @@
 
 #include <cstddef>
 #include "ftxui/dom/node.hpp"
-#include "ftxui/dom/selection.hpp"  // for Selection
-#include "ftxui/screen/screen.hpp"  // for Screen
+#include "ftxui/dom/selection.hpp"   // for Selection
+#include "ftxui/dom/viewport.hpp"    // for Visible
+#include "ftxui/screen/screen.hpp"   // for Screen
+#include "ftxui/util/autoreset.hpp"  // for AutoReset
 
 namespace ftxui {
 
 Node::Node() = default;
-Node::Node(Elements children) : children_(std::move(children)) {}
-Node::~Node() = default;
+
+Node::Node(Elements children) : children_(std::move(children)) {
+  for (auto& child : children_) {
+    if (!child) {
+      continue;
+    }
+    // An element shared by several parents can't tell all of them when it
+    // changes. Stop caching it, and so its parents.
+    if (child->parent_ && child->parent_ != this) {
+      child->cacheable_ = false;
+      child->Invalidate();
+    }
+    child->parent_ = this;
+  }
+}
+
+Node::~Node() {
+  for (auto& child : children_) {
+    if (child && child->parent_ == this) {
+      child->parent_ = nullptr;
+    }
+  }
+}
 
 /// @brief Compute how much space an element needs.
 void Node::ComputeRequirement() {
@@ -22,7 +45,7 @@ void Node::ComputeRequirement() {
     return;
   }
   for (auto& child : children_) {
-    child->ComputeRequirement();
+    child->ComputeRequirementIfDirty();
   }
 
   // By default, the requirement is the one of the first child.
@@ -64,11 +87,59 @@ void Node::Render(Screen& screen) {
 
 void Node::Check(Status* status) {
   for (auto& child : children_) {
-    child->Check(status);
+    child->CheckIfDirty(status);
   }
   status->need_iteration |= (status->iteration == 0);
 }
 
+/// @brief Compute the requirement, unless it is cached.
+void Node::ComputeRequirementIfDirty() {
+  if (requirement_valid_) {
+    return;
+  }
+  ComputeRequirement();
+
+  subtree_cacheable_ = cacheable_;
+  for (auto& child : children_) {
+    subtree_cacheable_ &= child->subtree_cacheable_;
+  }
+  requirement_valid_ = subtree_cacheable_;
+  box_valid_ = false;
+}
+
+/// @brief Assign a box, unless the element is already laid out in it.
+void Node::SetBoxIfDirty(Box box) {
+  // The containers skip the children outside of the visible area. The layout
+  // depends on it too.
+  const Box& visible = viewport::Visible();
+  if (box_valid_ && box == valid_box_ && visible == valid_visible_) {
+    return;
+  }
+  SetBox(box);
+  box_valid_ = requirement_valid_;
+  valid_box_ = box;
+  valid_visible_ = visible;
+}
+
+/// @brief Check the element, unless its layout is cached. A cached layout
+/// never needs another iteration.
+void Node::CheckIfDirty(Status* status) {
+  if (requirement_valid_ && box_valid_) {
+    return;
+  }
+  Check(status);
+}
+
+/// @brief Mark the element as changed. Its requirement and its box are
+/// computed again on the next layout, and so are the ones of its ancestors.
+void Node::Invalidate() {
+  requirement_valid_ = false;
+  box_valid_ = false;
+  if (parent_ && parent_->requirement_valid_) {
+    parent_->Invalidate();
+  }
+}
+
 std::string Node::GetSelectedContent(Selection& selection) {
   std::string content;
 
@@ -105,10 +176,12 @@ void Render(Screen& screen, Node* node, Selection& selection) {
   const int max_iterations = 20;
   while (status.need_iteration && status.iteration < max_iterations) {
     // Step 1: Find what dimension this elements wants to be.
-    node->ComputeRequirement();
+    node->ComputeRequirementIfDirty();
 
-    // Step 2: Assign a dimension to the element.
-    node->SetBox(box);
+    // Step 2: Assign a dimension to the element. Only what is visible on the
+    // screen is laid out.
+    const AutoReset<Box> visible(&viewport::Visible(), box);
+    node->SetBoxIfDirty(box);
 
     // Check if the element needs another iteration of the layout algorithm.
     status.need_iteration = false;
@@ -179,10 +252,11 @@ std::string GetNodeSelectedContent(Screen& screen,
   const int max_iterations = 20;
   while (status.need_iteration && status.iteration < max_iterations) {
     // Step 1: Find what dimension this elements wants to be.
-    node->ComputeRequirement();
+    node->ComputeRequirementIfDirty();
 
     // Step 2: Assign a dimension to the element.
-    node->SetBox(box);
+    const AutoReset<Box> visible(&viewport::Visible(), box);
+    node->SetBoxIfDirty(box);
 
     // Check if the element needs another iteration of the layout algorithm.
     status.need_iteration = false;
@@ -15,7 +15,9 @@ struct Box;
 // Helper class.
 class NodeDecorator : public Node {
  public:
-  explicit NodeDecorator(Element child) : Node(unpack(std::move(child))) {}
+  explicit NodeDecorator(Element child) : Node(unpack(std::move(child))) {
+    cacheable_ = true;
+  }
   void ComputeRequirement() override;
   void SetBox(Box box) override;
 };
@@ -1,43 +1,373 @@
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
-#include <functional>  // for function
-#include <sstream>     // for basic_istream, stringstream
-#include <string>      // for string, allocator, getline
-#include <utility>     // for move
+#include <algorithm>    // for max, min, partition_point, reverse
+#include <cstddef>      // for size_t
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <utility>      // for move
+#include <vector>       // for vector
 
-#include "ftxui/dom/elements.hpp"  // for flexbox, Element, text, Elements, operator|, xflex, paragraph, paragraphAlignCenter, paragraphAlignJustify, paragraphAlignLeft, paragraphAlignRight
-#include "ftxui/dom/flexbox_config.hpp"  // for FlexboxConfig, FlexboxConfig::JustifyContent, FlexboxConfig::JustifyContent::Center, FlexboxConfig::JustifyContent::FlexEnd, FlexboxConfig::JustifyContent::SpaceBetween
+#include "ftxui/dom/element_arena.hpp"  // for MakeElement
+#include "ftxui/dom/elements.hpp"  // for Element, paragraph, paragraphAlignCenter, paragraphAlignJustify, paragraphAlignLeft, paragraphAlignRight
+#include "ftxui/dom/node.hpp"         // for Node, Node::Status
+#include "ftxui/dom/requirement.hpp"  // for Requirement
+#include "ftxui/dom/selection.hpp"    // for Selection
+#include "ftxui/dom/styled_text.hpp"  // for StyledText
+#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/screen.hpp"    // for Screen
+#include "ftxui/screen/string.hpp"    // for Glyph, Glyphs
 
 namespace ftxui {
 
 namespace {
-Elements Split(const std::string& the_text) {
-  Elements output;
-  std::stringstream ss(the_text);
-  std::string word;
-  while (std::getline(ss, word, ' ')) {
-    output.push_back(text(word));
+
+enum class Alignment { Left, Right, Center, Justify };
+
+// A text wrapped at its spaces. The words are measured once, and the rows are
+// computed once per width. Like in a flexbox, the words are separated by a
+// single space, and a word wider than the paragraph gets a row of its own.
+//
+// A StyledText keeps its runs. The style of every glyph is looked up while
+// drawing it.
+class Paragraph : public Node {
+ public:
+  Paragraph(std::string text, Alignment alignment)
+      : text_(std::move(text)), alignment_(alignment) {
+    Segment();
   }
-  return output;
-}
 
-Element Split(const std::string& paragraph,
-              const std::function<Element(std::string)>& f) {
-  Elements output;
-  std::stringstream ss(paragraph);
-  std::string line;
-  while (std::getline(ss, line, '\n')) {
-    output.push_back(f(line));
+  // Unlike paragraph(), the empty lines of a StyledText take a row, like the
+  // empty lines of the output of a program.
+  Paragraph(const StyledText& text, Alignment alignment)
+      : text_(text.text()),
+        alignment_(alignment),
+        runs_(text.runs()),
+        styles_(text.styles()),
+        keep_empty_lines_(true) {
+    Segment();
   }
-  return vbox(std::move(output));
-}
+
+ private:
+  // A word, as a range of bytes of the text.
+  struct Word {
+    size_t offset = 0;
+    size_t size = 0;
+    int width = 0;
+  };
+
+  // The words [first, last) drawn on the same row.
+  struct Row {
+    size_t first = 0;
+    size_t last = 0;
+    int width = 0;
+    bool ends_line = false;  // The last row of a line of the text.
+  };
+
+  // The rows of the paragraph, for a given width.
+  struct Wrapping {
+    int width = -1;
+    int min_x = 0;
+    std::vector<Row> rows;
+  };
+
+  // A word placed on a row.
+  struct Placed {
+    const Word* word;
+    int x;
+  };
+
+  void ComputeRequirement() override {
+    requirement_ = Requirement{};
+    const Wrapping& wrapping = Wrap(asked_);
+    requirement_.min_x = wrapping.min_x;
+    requirement_.min_y = int(wrapping.rows.size());
+  }
+
+  void SetBox(Box box) override {
+    Node::SetBox(box);
+
+    // Like a flexbox, measure the paragraph again once its width is known.
+    const int asked_previous = asked_;
+    asked_ = std::min(asked_, box.x_max - box.x_min + 1);
+    need_iteration_ = (asked_ != asked_previous);
+  }
+
+  void Check(Status* status) override {
+    if (status->iteration == 0) {
+      asked_ = kUnbounded;
+      need_iteration_ = true;
+    }
+    status->need_iteration |= need_iteration_;
+  }
+
+  void Select(Selection& selection) override {
+    selection_.clear();
+    if (Box::Intersection(selection.GetBox(), box_).IsEmpty()) {
+      return;
+    }
+
+    Selection selection_rows = selection.SaturateHorizontal(box_);
+    const Wrapping& wrapping = Wrap(box_.x_max - box_.x_min + 1);
+    const int y_max =
+        std::min(box_.y_max, box_.y_min + int(wrapping.rows.size()) - 1);
+    for (int y = box_.y_min; y <= y_max; ++y) {
+      const Box row_box = {box_.x_min, box_.x_max, y, y};
+      if (Box::Intersection(selection.GetBox(), row_box).IsEmpty()) {
+        continue;
+      }
+
+      const Box range = selection_rows.SaturateVertical(row_box).GetBox();
+
+      // The selected glyphs, separated by a space when they are on different
+      // words.
+      std::string selected;
+      int next = 0;
+      for (const Placed& placed : Place(wrapping.rows[y - box_.y_min])) {
+        int x = box_.x_min + placed.x;
+        for (const Glyph& glyph : Glyphs(View(*placed.word))) {
+          if (range.x_min <= x && x <= range.x_max) {
+            if (!selected.empty() && x > next) {
+              selected += ' ';
+            }
+            selected += glyph.value;
+            next = x + glyph.width;
+          }
+          x += glyph.width;
+        }
+      }
+
+      selection_.push_back(range);
+      selection.AddPart(selected, y, range.x_min, range.x_max);
+    }
+  }
+
+  void Render(Screen& screen) override {
+    const Wrapping& wrapping = Wrap(box_.x_max - box_.x_min + 1);
+
+    // Only the rows on the screen are drawn.
+    const int y_min = std::max(box_.y_min, screen.stencil.y_min);
+    const int y_max =
+        std::min({box_.y_max, screen.stencil.y_max,
+                  box_.y_min + int(wrapping.rows.size()) - 1});
+    for (int y = y_min; y <= y_max; ++y) {
+      for (const Placed& placed : Place(wrapping.rows[y - box_.y_min])) {
+        const Word& word = *placed.word;
+        auto run = FirstRun(word.offset);
+        int x = box_.x_min + placed.x;
+        const GlyphRange glyphs = Glyphs(View(word));
+        for (auto it = glyphs.begin(); it != glyphs.end(); ++it) {
+          if (x > box_.x_max) {
+            break;
+          }
+          const StyledText::Style* style =
+              StyleAt(word.offset + it.position(), run);
+          PutGlyph(screen, x++, y, it->value, style);
+
+          // Fullwidth glyphs take two cells. The second is left empty.
+          if (it->width == 2 && x <= box_.x_max) {
+            PutGlyph(screen, x++, y, {}, style);
+          }
+        }
+      }
+    }
+
+    // The selection is set again by Select() on the next frame.
+    selection_.clear();
+  }
+
+  // Split the lines of the text into words, like std::getline. An empty line
+  // has no words, and neither has a trailing space.
+  void Segment() {
+    const std::string_view view = text_;
+    size_t line_begin = 0;
+    while (line_begin < view.size()) {
+      size_t line_end = view.find('\n', line_begin);
+      if (line_end == std::string_view::npos) {
+        line_end = view.size();
+      }
+
+      size_t word_begin = line_begin;
+      while (word_begin < line_end) {
+        size_t word_end = view.find(' ', word_begin);
+        if (word_end == std::string_view::npos || word_end > line_end) {
+          word_end = line_end;
+        }
+        Word word;
+        word.offset = word_begin;
+        word.size = word_end - word_begin;
+        for (const Glyph& glyph : Glyphs(View(word))) {
+          word.width += glyph.width;
+        }
+        words_.push_back(word);
+        word_begin = word_end + 1;
+      }
+
+      line_ends_.push_back(words_.size());
+      line_begin = line_end + 1;
+    }
+  }
+
+  // The rows for a given width. The two last wrappings are kept: the one used
+  // to compute the requirement, and the one drawn.
+  const Wrapping& Wrap(int width) {
+    for (const Wrapping& wrapping : wrappings_) {
+      if (wrapping.width == width) {
+        return wrapping;
+      }
+    }
+
+    Wrapping& wrapping = wrappings_[next_wrapping_];
+    next_wrapping_ = 1 - next_wrapping_;
+    wrapping.width = width;
+    wrapping.min_x = 0;
+    wrapping.rows.clear();
+
+    auto add_row = [&](size_t first, size_t last, int row_width,
+                       bool ends_line) {
+      wrapping.rows.push_back({first, last, row_width, ends_line});
+      wrapping.min_x = std::max(wrapping.min_x, row_width);
+    };
+
+    size_t line_begin = 0;
+    for (const size_t line_end : line_ends_) {
+      size_t row_begin = line_begin;
+      int x = 0;
+      for (size_t i = line_begin; i < line_end; ++i) {
+        // Start a new row, unless the word is too wide for any.
+        if (i != row_begin && x + words_[i].width > width) {
+          add_row(row_begin, i, x - 1, false);
+          row_begin = i;
+          x = 0;
+        }
+        x += words_[i].width + 1;
+      }
+      if (row_begin != line_end) {
+        add_row(row_begin, line_end, x - 1, true);
+      } else if (line_begin == line_end && keep_empty_lines_) {
+        add_row(line_begin, line_end, 0, true);
+      }
+      line_begin = line_end;
+    }
+    return wrapping;
+  }
+
+  // Position the words of a row inside the paragraph.
+  const std::vector<Placed>& Place(const Row& row) {
+    const int width = box_.x_max - box_.x_min + 1;
+    const int remaining = std::max(0, width - row.width);
+    int shift = 0;
+    int space = 0;
+    switch (alignment_) {
+      case Alignment::Left:
+        break;
+      case Alignment::Right:
+        shift = remaining;
+        break;
+      case Alignment::Center:
+        shift = remaining / 2;
+        break;
+      case Alignment::Justify:
+        // The last row of a line is aligned on the left.
+        space = row.ends_line ? 0 : remaining;
+        break;
+    }
+
+    // Distribute the space between the words, from the last one, like
+    // FlexboxConfig::JustifyContent::SpaceBetween. The first word doesn't move.
+    placed_.clear();
+    int x = row.width;
+    for (size_t i = row.last; i-- > row.first;) {
+      x -= words_[i].width;
+      const int index = int(i - row.first);
+      if (index == 0) {
+        space = 0;
+      }
+      placed_.push_back({&words_[i], shift + x + space});
+      if (index >= 1) {
+        space = space * (index - 1) / index;
+      }
+      x -= 1;
+    }
+    std::reverse(placed_.begin(), placed_.end());
+    return placed_;
+  }
+
+  std::string_view View(const Word& word) const {
+    return std::string_view(text_).substr(word.offset, word.size);
+  }
+
+  using RunIterator = std::vector<StyledText::Run>::const_iterator;
+
+  // The first run not ending before |position|.
+  RunIterator FirstRun(size_t position) const {
+    return std::partition_point(
+        runs_.begin(), runs_.end(), [&](const StyledText::Run& run) {
+          return run.offset + run.length <= position;
+        });
+  }
+
+  // The style of the byte at |position|, if any. The runs are sorted: |run| is
+  // advanced toward it, for the next positions.
+  const StyledText::Style* StyleAt(size_t position, RunIterator& run) const {
+    while (run != runs_.end() && run->offset + run->length <= position) {
+      ++run;
+    }
+    if (run == runs_.end() || run->offset > position) {
+      return nullptr;
+    }
+    return &styles_[run->style];
+  }
+
+  void PutGlyph(Screen& screen,
+                int x,
+                int y,
+                std::string_view cell,
+                const StyledText::Style* style) const {
+    Pixel& pixel = screen.PixelAt(x, y);
+    pixel.character = cell;
+    if (style) {
+      style->Apply(pixel);
+    }
+
+    if (selection_.empty()) {
+      return;
+    }
+    const int index = y - selection_.front().y_min;
+    if (index < 0 || index >= int(selection_.size())) {
+      return;
+    }
+    const Box& range = selection_[index];
+    if (range.x_min <= x && x <= range.x_max) {
+      screen.GetSelectionStyle()(pixel);
+    }
+  }
+
+  static constexpr int kUnbounded = 6000;
+
+  const std::string text_;
+  const Alignment alignment_;
+  const std::vector<StyledText::Run> runs_;
+  const std::vector<StyledText::Style> styles_;
+  const bool keep_empty_lines_ = false;
+  std::vector<Word> words_;
+  std::vector<size_t> line_ends_;  // One past the last word of every line.
+
+  Wrapping wrappings_[2];
+  int next_wrapping_ = 0;
+  std::vector<Placed> placed_;
+
+  int asked_ = kUnbounded;
+  bool need_iteration_ = true;
+
+  // The selected range of the rows, from the first selected one.
+  std::vector<Box> selection_;
+};
 
 }  // namespace
 
 /// @brief Return an element drawing the paragraph on multiple lines.
 /// @ingroup dom
-/// @see flexbox.
 Element paragraph(const std::string& the_text) {
   return paragraphAlignLeft(the_text);
 }
@@ -45,51 +375,46 @@ Element paragraph(const std::string& the_text) {
 /// @brief Return an element drawing the paragraph on multiple lines, aligned on
 /// the left.
 /// @ingroup dom
-/// @see flexbox.
 Element paragraphAlignLeft(const std::string& the_text) {
-  return Split(the_text, [](const std::string& line) {
-    static const auto config = FlexboxConfig().SetGap(1, 0);
-    return flexbox(Split(line), config);
-  });
+  return MakeElement<Paragraph>(the_text, Alignment::Left);
 };
 
 /// @brief Return an element drawing the paragraph on multiple lines, aligned on
 /// the right.
 /// @ingroup dom
-/// @see flexbox.
 Element paragraphAlignRight(const std::string& the_text) {
-  return Split(the_text, [](const std::string& line) {
-    static const auto config = FlexboxConfig().SetGap(1, 0).Set(
-        FlexboxConfig::JustifyContent::FlexEnd);
-    return flexbox(Split(line), config);
-  });
+  return MakeElement<Paragraph>(the_text, Alignment::Right);
 }
 
 /// @brief Return an element drawing the paragraph on multiple lines, aligned on
 /// the center.
 /// @ingroup dom
-/// @see flexbox.
 Element paragraphAlignCenter(const std::string& the_text) {
-  return Split(the_text, [](const std::string& line) {
-    static const auto config =
-        FlexboxConfig().SetGap(1, 0).Set(FlexboxConfig::JustifyContent::Center);
-    return flexbox(Split(line), config);
-  });
+  return MakeElement<Paragraph>(the_text, Alignment::Center);
 }
 
 /// @brief Return an element drawing the paragraph on multiple lines, aligned
-/// using a justified alignment.
-/// the center.
+/// using a justified alignment. The last row of every line is aligned on the
+/// left.
 /// @ingroup dom
-/// @see flexbox.
 Element paragraphAlignJustify(const std::string& the_text) {
-  return Split(the_text, [](const std::string& line) {
-    static const auto config = FlexboxConfig().SetGap(1, 0).Set(
-        FlexboxConfig::JustifyContent::SpaceBetween);
-    Elements words = Split(line);
-    words.push_back(text("") | xflex);
-    return flexbox(std::move(words), config);
-  });
+  return MakeElement<Paragraph>(the_text, Alignment::Justify);
+}
+
+/// @brief Return an element drawing a StyledText on multiple lines. Its lines
+/// are wrapped at spaces, like paragraph().
+/// @ingroup dom
+/// @see paragraph
+Element styledParagraph(const StyledText& text) {
+  return MakeElement<Paragraph>(text, Alignment::Left);
+}
+
+/// @brief Return an element drawing a text containing ANSI escape sequences on
+/// multiple lines. Its lines are wrapped at spaces, like paragraph().
+/// @ingroup dom
+/// @see paragraph
+Element ansiParagraph(std::string_view text) {
+  return styledParagraph(StyledText().AppendAnsi(text));
 }
 
 }  // namespace ftxui
@@ -0,0 +1,125 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <string>  // for string
+
+#include "ftxui/dom/elements.hpp"  // for paragraph, paragraphAlignRight, paragraphAlignCenter, paragraphAlignJustify, hbox, text, vbox, focus, yframe
+#include "ftxui/dom/node.hpp"       // for Render
+#include "ftxui/dom/selection.hpp"  // for Selection
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+const std::string kText = "The quick brown fox jumps over the lazy dog";
+}  // namespace
+
+TEST(ParagraphTest, AlignLeft) {
+  Screen screen(12, 5);
+  Render(screen, paragraph(kText));
+  EXPECT_EQ(screen.ToString(),
+            "The quick   \r\n"
+            "brown fox   \r\n"
+            "jumps over  \r\n"
+            "the lazy dog\r\n"
+            "            ");
+}
+
+TEST(ParagraphTest, AlignRight) {
+  Screen screen(12, 4);
+  Render(screen, paragraphAlignRight(kText));
+  EXPECT_EQ(screen.ToString(),
+            "   The quick\r\n"
+            "   brown fox\r\n"
+            "  jumps over\r\n"
+            "the lazy dog");
+}
+
+TEST(ParagraphTest, AlignCenter) {
+  Screen screen(12, 4);
+  Render(screen, paragraphAlignCenter(kText));
+  EXPECT_EQ(screen.ToString(),
+            " The quick  \r\n"
+            " brown fox  \r\n"
+            " jumps over \r\n"
+            "the lazy dog");
+}
+
+TEST(ParagraphTest, AlignJustify) {
+  Screen screen(12, 4);
+  Render(screen, paragraphAlignJustify(kText + " again"));
+  EXPECT_EQ(screen.ToString(),
+            "The    quick\r\n"
+            "brown    fox\r\n"
+            "jumps   over\r\n"
+            "the lazy dog");
+
+  // The last row of every line is aligned on the left.
+  Screen last(12, 2);
+  Render(last, paragraphAlignJustify("one two three\nfour five"));
+  EXPECT_EQ(last.ToString(),
+            "one      two\r\n"
+            "three       ");
+}
+
+TEST(ParagraphTest, Lines) {
+  Screen screen(10, 3);
+  Render(screen, paragraph("first line\nsecond  one"));
+  EXPECT_EQ(screen.ToString(),
+            "first line\r\n"
+            "second    \r\n"
+            "one       ");
+}
+
+TEST(ParagraphTest, LongWord) {
+  Screen screen(6, 3);
+  Render(screen, paragraph("a verylongword b"));
+  EXPECT_EQ(screen.ToString(),
+            "a     \r\n"
+            "verylo\r\n"
+            "b     ");
+}
+
+TEST(ParagraphTest, Fullwidth) {
+  Screen screen(5, 2);
+  Render(screen, paragraph("测试 测试"));
+  EXPECT_EQ(screen.ToString(),
+            "测试 \r\n"
+            "测试 ");
+}
+
+TEST(ParagraphTest, ShrinkInHbox) {
+  Screen screen(12, 4);
+  Render(screen, hbox({text("["), paragraph(kText), text("]")}));
+  EXPECT_EQ(screen.ToString(),
+            "[The quick ]\r\n"
+            " brown fox  \r\n"
+            " jumps over \r\n"
+            " the lazy   ");
+}
+
+TEST(ParagraphTest, Focus) {
+  Elements lines;
+  for (int i = 0; i < 100; ++i) {
+    lines.push_back(paragraph("line " + std::to_string(i)));
+  }
+  lines[50] = lines[50] | focus;
+  Screen screen(7, 3);
+  Render(screen, vbox(std::move(lines)) | yframe);
+  EXPECT_EQ(screen.ToString(),
+            "line 49\r\n"
+            "line 50\r\n"
+            "line 51");
+}
+
+TEST(ParagraphTest, Selection) {
+  Screen screen(12, 4);
+  Selection selection(4, 0, 4, 1);
+  Render(screen, paragraph(kText).get(), selection);
+  EXPECT_EQ(selection.GetParts(), "quick\nbrown");
+}
+
+}  // namespace ftxui
+// NOLINTEND
@@ -4,11 +4,12 @@
 #include <memory>   // for make_shared, __shared_ptr_access
 #include <utility>  // for move
 
+#include "ftxui/dom/element_arena.hpp"  // for MakeElement
 #include "ftxui/dom/elements.hpp"     // for Element, unpack, Decorator, reflect
-#include "ftxui/dom/node.hpp"         // for Node, Elements
-#include "ftxui/dom/requirement.hpp"  // for Requirement
-#include "ftxui/screen/box.hpp"       // for Box
-#include "ftxui/screen/screen.hpp"    // for Screen
+#include "ftxui/dom/node.hpp"           // for Node, Elements
+#include "ftxui/dom/requirement.hpp"    // for Requirement
+#include "ftxui/screen/box.hpp"         // for Box
+#include "ftxui/screen/screen.hpp"      // for Screen
 
 namespace ftxui {
 namespace {
@@ -17,7 +18,10 @@ namespace {
 class Reflect : public Node {
  public:
   Reflect(Element child, Box& box)
-      : Node(unpack(std::move(child))), reflected_box_(box) {}
+      : Node(unpack(std::move(child))), reflected_box_(box) {
+    // Empty, unless the element is laid out on the screen.
+    reflected_box_ = Box{0, -1, 0, -1};
+  }
 
   void ComputeRequirement() final {
     Node::ComputeRequirement();
@@ -27,7 +31,7 @@ class Reflect : public Node {
   void SetBox(Box box) final {
     reflected_box_ = box;
     Node::SetBox(box);
-    children_[0]->SetBox(box);
+    children_[0]->SetBoxIfDirty(box);
   }
 
   void Render(Screen& screen) final {
@@ -42,7 +46,7 @@ class Reflect : public Node {
 
 Decorator reflect(Box& box) {
   return [&](Element child) -> Element {
-    return std::make_shared<Reflect>(std::move(child), box);
+    return MakeElement<Reflect>(std::move(child), box);
   };
 }
 
@@ -5,6 +5,7 @@
 #include <memory>      // for make_shared
 #include <utility>     // for move
 
+#include "ftxui/dom/element_arena.hpp"   // for MakeElement
 #include "ftxui/dom/elements.hpp"  // for Element, Decorator, bgcolor, color
 #include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
 #include "ftxui/screen/color.hpp"        // for Color
@@ -53,7 +54,7 @@ class SelectionStyle : public NodeDecorator {
 /// @param child The input element.
 /// @return The output element with the selection style reset.
 Element selectionStyleReset(Element child) {
-  return std::make_shared<SelectionStyleReset>(std::move(child));
+  return MakeElement<SelectionStyleReset>(std::move(child));
 }
 
 /// @brief Set the background color of an element when selected.
@@ -85,7 +86,7 @@ Decorator selectionColor(Color foreground) {
 // NOLINTNEXTLINE
 Decorator selectionStyle(std::function<void(Pixel&)> style) {
   return [style](Element child) -> Element {
-    return std::make_shared<SelectionStyle>(std::move(child), style);
+    return MakeElement<SelectionStyle>(std::move(child), style);
   };
 }
 
@@ -1,26 +1,28 @@
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
-#include <array>    // for array, array<>::value_type
-#include <memory>   // for make_shared, allocator
-#include <string>   // for basic_string, string
-#include <utility>  // for move
-
-#include "ftxui/dom/elements.hpp"  // for Element, BorderStyle, LIGHT, separator, DOUBLE, EMPTY, HEAVY, separatorCharacter, separatorDouble, separatorEmpty, separatorHSelector, separatorHeavy, separatorLight, separatorStyled, separatorVSelector
-#include "ftxui/dom/node.hpp"      // for Node
-#include "ftxui/dom/requirement.hpp"  // for Requirement
-#include "ftxui/screen/box.hpp"       // for Box
-#include "ftxui/screen/color.hpp"     // for Color
-#include "ftxui/screen/pixel.hpp"     // for Pixel
-#include "ftxui/screen/screen.hpp"    // for Pixel, Screen
+#include <array>        // for array, array<>::value_type
+#include <memory>       // for make_shared, allocator
+#include <string>       // for basic_string, string
+#include <string_view>  // for string_view
+#include <utility>      // for move
+
+#include "ftxui/dom/element_arena.hpp"  // for MakeElement
+#include "ftxui/dom/elements.hpp"       // for Element, BorderStyle, LIGHT, separator, DOUBLE, EMPTY, HEAVY, separatorCharacter, separatorDouble, separatorEmpty, separatorHSelector, separatorHeavy, separatorLight, separatorStyled, separatorVSelector
+#include "ftxui/dom/node.hpp"           // for Node
+#include "ftxui/dom/requirement.hpp"    // for Requirement
+#include "ftxui/screen/box.hpp"         // for Box
+#include "ftxui/screen/color.hpp"       // for Color
+#include "ftxui/screen/pixel.hpp"       // for Pixel
+#include "ftxui/screen/screen.hpp"      // for Pixel, Screen
 
 namespace ftxui {
 
 namespace {
-using Charset = std::array<std::string, 2>;  // NOLINT
+using Charset = std::array<std::string_view, 2>;  // NOLINT
 using Charsets = std::array<Charset, 6>;     // NOLINT
 // NOLINTNEXTLINE
-const Charsets charsets = {
+constexpr Charsets charsets = {
     Charset{"│", "─"},  // LIGHT
     Charset{"╏", "╍"},  // DASHED
     Charset{"┃", "━"},  // HEAVY
@@ -31,7 +33,9 @@ const Charsets charsets = {
 
 class Separator : public Node {
  public:
-  explicit Separator(std::string value) : value_(std::move(value)) {}
+  explicit Separator(std::string value) : value_(std::move(value)) {
+    cacheable_ = true;
+  }
 
   void ComputeRequirement() override {
     requirement_.min_x = 1;
@@ -45,6 +49,7 @@ class Separator : public Node {
         pixel.character = value_;
         pixel.automerge = true;
       }
+      screen.MarkAutomerge(y);
     }
   }
 
@@ -53,7 +58,9 @@ class Separator : public Node {
 
 class SeparatorAuto : public Node {
  public:
-  explicit SeparatorAuto(BorderStyle style) : style_(style) {}
+  explicit SeparatorAuto(BorderStyle style) : style_(style) {
+    cacheable_ = true;
+  }
 
   void ComputeRequirement() override {
     requirement_.min_x = 1;
@@ -64,7 +71,7 @@ class SeparatorAuto : public Node {
     const bool is_column = (box_.x_max == box_.x_min);
     const bool is_line = (box_.y_min == box_.y_max);
 
-    const std::string c =
+    const std::string_view c =
         charsets[style_][int(is_line && !is_column)];  // NOLINT
 
     for (int y = box_.y_min; y <= box_.y_max; ++y) {
@@ -73,6 +80,7 @@ class SeparatorAuto : public Node {
         pixel.character = c;
         pixel.automerge = true;
       }
+      screen.MarkAutomerge(y);
     }
   }
 
@@ -90,6 +98,7 @@ class SeparatorWithPixel : public SeparatorAuto {
       for (int x = box_.x_min; x <= box_.x_max; ++x) {
         screen.PixelAt(x, y) = pixel_;
       }
+      screen.MarkAutomerge(y);
     }
   }
 
@@ -132,7 +141,7 @@ class SeparatorWithPixel : public SeparatorAuto {
 /// down
 /// ```
 Element separator() {
-  return std::make_shared<SeparatorAuto>(LIGHT);
+  return MakeElement<SeparatorAuto>(LIGHT);
 }
 
 /// @brief Draw a vertical or horizontal separation in between two other
@@ -170,7 +179,7 @@ Element separator() {
 /// down
 /// ```
 Element separatorStyled(BorderStyle style) {
-  return std::make_shared<SeparatorAuto>(style);
+  return MakeElement<SeparatorAuto>(style);
 }
 
 /// @brief Draw a vertical or horizontal separation in between two other
@@ -207,7 +216,7 @@ Element separatorStyled(BorderStyle style) {
 /// down
 /// ```
 Element separatorLight() {
-  return std::make_shared<SeparatorAuto>(LIGHT);
+  return MakeElement<SeparatorAuto>(LIGHT);
 }
 
 /// @brief Draw a vertical or horizontal separation in between two other
@@ -244,7 +253,7 @@ Element separatorLight() {
 /// down
 /// ```
 Element separatorDashed() {
-  return std::make_shared<SeparatorAuto>(DASHED);
+  return MakeElement<SeparatorAuto>(DASHED);
 }
 
 /// @brief Draw a vertical or horizontal separation in between two other
@@ -281,7 +290,7 @@ Element separatorDashed() {
 /// down
 /// ```
 Element separatorHeavy() {
-  return std::make_shared<SeparatorAuto>(HEAVY);
+  return MakeElement<SeparatorAuto>(HEAVY);
 }
 
 /// @brief Draw a vertical or horizontal separation in between two other
@@ -318,7 +327,7 @@ Element separatorHeavy() {
 /// down
 /// ```
 Element separatorDouble() {
-  return std::make_shared<SeparatorAuto>(DOUBLE);
+  return MakeElement<SeparatorAuto>(DOUBLE);
 }
 
 /// @brief Draw a vertical or horizontal separation in between two other
@@ -355,7 +364,7 @@ Element separatorDouble() {
 /// down
 /// ```
 Element separatorEmpty() {
-  return std::make_shared<SeparatorAuto>(EMPTY);
+  return MakeElement<SeparatorAuto>(EMPTY);
 }
 
 /// @brief Draw a vertical or horizontal separation in between two other
@@ -393,7 +402,7 @@ Element separatorEmpty() {
 /// down
 /// ```
 Element separatorCharacter(std::string value) {
-  return std::make_shared<Separator>(std::move(value));
+  return MakeElement<Separator>(std::move(value));
 }
 
 /// @brief Draw a separator in between two element filled with a given pixel.
@@ -424,7 +433,7 @@ Element separatorCharacter(std::string value) {
 /// Down
 /// ```
 Element separator(Pixel pixel) {
-  return std::make_shared<SeparatorWithPixel>(std::move(pixel));
+  return MakeElement<SeparatorWithPixel>(std::move(pixel));
 }
 
 /// @brief Draw a horizontal bar, with the area in between left/right colored
@@ -449,7 +458,9 @@ Element separatorHSelector(float left,
         : left_(left),
           right_(right),
           unselected_color_(unselected_color),
-          selected_color_(selected_color) {}
+          selected_color_(selected_color) {
+      cacheable_ = true;
+    }
     void ComputeRequirement() override {
       requirement_.min_x = 1;
       requirement_.min_y = 1;
@@ -465,6 +476,7 @@ Element separatorHSelector(float left,
       int demi_cell_right = int(right_ * 2.F + 2.F);  // NOLINT
 
       const int y = box_.y_min;
+      screen.MarkAutomerge(y);
       for (int x = box_.x_min; x <= box_.x_max; ++x) {
         Pixel& pixel = screen.PixelAt(x, y);
 
@@ -494,7 +506,7 @@ Element separatorHSelector(float left,
     Color unselected_color_;
     Color selected_color_;
   };
-  return std::make_shared<Impl>(left, right, unselected_color, selected_color);
+  return MakeElement<Impl>(left, right, unselected_color, selected_color);
 }
 
 /// @brief Draw an vertical bar, with the area in between up/downcolored
@@ -519,7 +531,9 @@ Element separatorVSelector(float up,
         : up_(up),
           down_(down),
           unselected_color_(unselected_color),
-          selected_color_(selected_color) {}
+          selected_color_(selected_color) {
+      cacheable_ = true;
+    }
     void ComputeRequirement() override {
       requirement_.min_x = 1;
       requirement_.min_y = 1;
@@ -536,6 +550,7 @@ Element separatorVSelector(float up,
 
       const int x = box_.x_min;
       for (int y = box_.y_min; y <= box_.y_max; ++y) {
+        screen.MarkAutomerge(y);
         Pixel& pixel = screen.PixelAt(x, y);
 
         const int a = (y - box_.y_min) * 2;
@@ -564,7 +579,7 @@ Element separatorVSelector(float up,
     Color unselected_color_;
     Color selected_color_;
   };
-  return std::make_shared<Impl>(up, down, unselected_color, selected_color);
+  return MakeElement<Impl>(up, down, unselected_color, selected_color);
 }
 
 }  // namespace ftxui
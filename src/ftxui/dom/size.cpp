@@ -5,10 +5,11 @@
 #include <memory>     // for make_shared, __shared_ptr_access
 #include <utility>    // for move
 
-#include "ftxui/dom/elements.hpp"  // for Constraint, WidthOrHeight, EQUAL, GREATER_THAN, LESS_THAN, WIDTH, unpack, Decorator, Element, size
-#include "ftxui/dom/node.hpp"      // for Node, Elements
-#include "ftxui/dom/requirement.hpp"  // for Requirement
-#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/dom/element_arena.hpp"  // for MakeElement
+#include "ftxui/dom/elements.hpp"       // for Constraint, WidthOrHeight, EQUAL, GREATER_THAN, LESS_THAN, WIDTH, unpack, Decorator, Element, size
+#include "ftxui/dom/node.hpp"           // for Node, Elements
+#include "ftxui/dom/requirement.hpp"    // for Requirement
+#include "ftxui/screen/box.hpp"         // for Box
 
 namespace ftxui {
 
@@ -19,7 +20,9 @@ class Size : public Node {
       : Node(unpack(std::move(child))),
         direction_(direction),
         constraint_(constraint),
-        value_(std::max(0, value)) {}
+        value_(std::max(0, value)) {
+    cacheable_ = true;
+  }
 
   void ComputeRequirement() override {
     Node::ComputeRequirement();
@@ -70,7 +73,7 @@ class Size : public Node {
           break;
       }
     }
-    children_[0]->SetBox(box);
+    children_[0]->SetBoxIfDirty(box);
   }
 
  private:
@@ -88,7 +91,7 @@ class Size : public Node {
 /// @ingroup dom
 Decorator size(WidthOrHeight direction, Constraint constraint, int value) {
   return [=](Element e) {
-    return std::make_shared<Size>(std::move(e), direction, constraint, value);
+    return MakeElement<Size>(std::move(e), direction, constraint, value);
   };
 }
 
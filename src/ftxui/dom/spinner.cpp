@@ -11,265 +11,269 @@
 namespace ftxui {
 
 namespace {
-// NOLINTNEXTLINE
-const std::vector<std::vector<std::vector<std::string>>> elements = {
-    {
-        {"Replaced by the gauge"},
-    },
-    {
-        {".  "},
-        {".. "},
-        {"..."},
-    },
-    {
-        {"|"},
-        {"/"},
-        {"-"},
-        {"\\"},
-    },
-    {
-        {"+"},
-        {"x"},
-    },
-    {
-        {"|  "},
-        {"|| "},
-        {"|||"},
-    },
-    {
-        {"←"},
-        {"↖"},
-        {"↑"},
-        {"↗"},
-        {"→"},
-        {"↘"},
-        {"↓"},
-        {"↙"},
-    },
-    {
-        {"▁"},
-        {"▂"},
-        {"▃"},
-        {"▄"},
-        {"▅"},
-        {"▆"},
-        {"▇"},
-        {"█"},
-        {"▇"},
-        {"▆"},
-        {"▅"},
-        {"▄"},
-        {"▃"},
-        {"▁"},
-    },
-    {
-        {"▉"},
-        {"▊"},
-        {"▋"},
-        {"▌"},
-        {"▍"},
-        {"▎"},
-        {"▏"},
-        {"▎"},
-        {"▍"},
-        {"▌"},
-        {"▋"},
-        {"▊"},
-    },
-    {
-        {"▖"},
-        {"▘"},
-        {"▝"},
-        {"▗"},
-    },
-    {
-        {"◢"},
-        {"◣"},
-        {"◤"},
-        {"◥"},
-    },
-    {
-        {"◰"},
-        {"◳"},
-        {"◲"},
-        {"◱"},
-    },
-    {
-        {"◴"},
-        {"◷"},
-        {"◶"},
-        {"◵"},
-    },
-    {
-        {"◐"},
-        {"◓"},
-        {"◑"},
-        {"◒"},
-    },
-    {
-        {"◡"},
-        {"⊙"},
-        {"◠"},
-    },
-    {
-        {"⠁"},
-        {"⠂"},
-        {"⠄"},
-        {"⡀"},
-        {"⢀"},
-        {"⠠"},
-        {"⠐"},
-        {"⠈"},
-    },
-    {
-        {"⠋"},
-        {"⠙"},
-        {"⠹"},
-        {"⠸"},
-        {"⠼"},
-        {"⠴"},
-        {"⠦"},
-        {"⠧"},
-        {"⠇"},
-        {"⠏"},
-    },
-    {
-        {"(*----------)"}, {"(-*---------)"}, {"(--*--------)"},
-        {"(---*-------)"}, {"(----*------)"}, {"(-----*-----)"},
-        {"(------*----)"}, {"(-------*---)"}, {"(--------*--)"},
-        {"(---------*-)"}, {"(----------*)"}, {"(---------*-)"},
-        {"(--------*--)"}, {"(-------*---)"}, {"(------*----)"},
-        {"(-----*-----)"}, {"(----*------)"}, {"(---*-------)"},
-        {"(--*--------)"}, {"(-*---------)"},
-    },
-    {
-        {"[      ]"},
-        {"[=     ]"},
-        {"[==    ]"},
-        {"[===   ]"},
-        {"[====  ]"},
-        {"[===== ]"},
-        {"[======]"},
-        {"[===== ]"},
-        {"[====  ]"},
-        {"[===   ]"},
-        {"[==    ]"},
-        {"[=     ]"},
-    },
-    {
-        {"[      ]"},
-        {"[=     ]"},
-        {"[==    ]"},
-        {"[===   ]"},
-        {"[====  ]"},
-        {"[===== ]"},
-        {"[======]"},
-        {"[ =====]"},
-        {"[  ====]"},
-        {"[   ===]"},
-        {"[    ==]"},
-        {"[     =]"},
-    },
-    {
-        {"[==    ]"},
-        {"[==    ]"},
-        {"[==    ]"},
-        {"[==    ]"},
-        {"[==    ]"},
-        {" [==   ]"},
-        {"[  ==  ]"},
-        {"[   == ]"},
-        {"[    ==]"},
-        {"[    ==]"},
-        {"[    ==]"},
-        {"[    ==]"},
-        {"[    ==]"},
-        {"[   ==] "},
-        {"[  ==  ]"},
-        {"[ ==   ]"},
-    },
-    {
-        {
-            " ─╮",
-            "  │",
-            "   ",
-        },
-        {
-            "  ╮",
-            "  │",
-            "  ╯",
-        },
-        {
-            "   ",
-            "  │",
-            " ─╯",
-        },
-        {
-            "   ",
-            "   ",
-            "╰─╯",
-        },
-        {
-            "   ",
-            "│  ",
-            "╰─ ",
-        },
-        {
-            "╭  ",
-            "│  ",
-            "╰  ",
-        },
-        {
-            "╭─ ",
-            "│  ",
-            "   ",
-        },
-        {
-            "╭─╮",
-            "   ",
-            "   ",
-        },
-    },
-    {
-        {
-            "   /\\O ",
-            "    /\\/",
-            "   /\\  ",
-            "  /  \\ ",
-            "LOL  LOL",
-        },
-        {
-            "    _O  ",
-            "   //|_ ",
-            "    |   ",
-            "   /|   ",
-            "   LLOL ",
-        },
-        {
-            "     O  ",
-            "    /_  ",
-            "    |\\  ",
-            "   / |  ",
-            " LOLLOL ",
-        },
-    },
-    {
-        {"       ", "_______", "       "},
-        {"       ", "______/", "       "},
-        {"      _", "_____/ ", "       "},
-        {"     _ ", "____/ \\", "       "},
-        {"    _  ", "___/ \\ ", "      \\"},
-        {"   _   ", "__/ \\  ", "     \\_"},
-        {"  _    ", "_/ \\   ", "    \\_/"},
-        {" _     ", "/ \\   _", "   \\_/ "},
-        {"_      ", " \\   __", "  \\_/  "},
-        {"       ", "\\   ___", " \\_/   "},
-        {"       ", "    ___", "\\_/    "},
-        {"       ", "  _____", "_/     "},
-        {"       ", " ______", "/      "},
-        {"       ", "_______", "       "},
-    },
-};
+// The frames of every spinner. Built on first use, rather than at startup.
+const std::vector<std::vector<std::vector<std::string>>>& Frames() {
+  // NOLINTNEXTLINE
+  static const std::vector<std::vector<std::vector<std::string>>> elements = {
+      {
+          {"Replaced by the gauge"},
+      },
+      {
+          {".  "},
+          {".. "},
+          {"..."},
+      },
+      {
+          {"|"},
+          {"/"},
+          {"-"},
+          {"\\"},
+      },
+      {
+          {"+"},
+          {"x"},
+      },
+      {
+          {"|  "},
+          {"|| "},
+          {"|||"},
+      },
+      {
+          {"←"},
+          {"↖"},
+          {"↑"},
+          {"↗"},
+          {"→"},
+          {"↘"},
+          {"↓"},
+          {"↙"},
+      },
+      {
+          {"▁"},
+          {"▂"},
+          {"▃"},
+          {"▄"},
+          {"▅"},
+          {"▆"},
+          {"▇"},
+          {"█"},
+          {"▇"},
+          {"▆"},
+          {"▅"},
+          {"▄"},
+          {"▃"},
+          {"▁"},
+      },
+      {
+          {"▉"},
+          {"▊"},
+          {"▋"},
+          {"▌"},
+          {"▍"},
+          {"▎"},
+          {"▏"},
+          {"▎"},
+          {"▍"},
+          {"▌"},
+          {"▋"},
+          {"▊"},
+      },
+      {
+          {"▖"},
+          {"▘"},
+          {"▝"},
+          {"▗"},
+      },
+      {
+          {"◢"},
+          {"◣"},
+          {"◤"},
+          {"◥"},
+      },
+      {
+          {"◰"},
+          {"◳"},
+          {"◲"},
+          {"◱"},
+      },
+      {
+          {"◴"},
+          {"◷"},
+          {"◶"},
+          {"◵"},
+      },
+      {
+          {"◐"},
+          {"◓"},
+          {"◑"},
+          {"◒"},
+      },
+      {
+          {"◡"},
+          {"⊙"},
+          {"◠"},
+      },
+      {
+          {"⠁"},
+          {"⠂"},
+          {"⠄"},
+          {"⡀"},
+          {"⢀"},
+          {"⠠"},
+          {"⠐"},
+          {"⠈"},
+      },
+      {
+          {"⠋"},
+          {"⠙"},
+          {"⠹"},
+          {"⠸"},
+          {"⠼"},
+          {"⠴"},
+          {"⠦"},
+          {"⠧"},
+          {"⠇"},
+          {"⠏"},
+      },
+      {
+          {"(*----------)"}, {"(-*---------)"}, {"(--*--------)"},
+          {"(---*-------)"}, {"(----*------)"}, {"(-----*-----)"},
+          {"(------*----)"}, {"(-------*---)"}, {"(--------*--)"},
+          {"(---------*-)"}, {"(----------*)"}, {"(---------*-)"},
+          {"(--------*--)"}, {"(-------*---)"}, {"(------*----)"},
+          {"(-----*-----)"}, {"(----*------)"}, {"(---*-------)"},
+          {"(--*--------)"}, {"(-*---------)"},
+      },
+      {
+          {"[      ]"},
+          {"[=     ]"},
+          {"[==    ]"},
+          {"[===   ]"},
+          {"[====  ]"},
+          {"[===== ]"},
+          {"[======]"},
+          {"[===== ]"},
+          {"[====  ]"},
+          {"[===   ]"},
+          {"[==    ]"},
+          {"[=     ]"},
+      },
+      {
+          {"[      ]"},
+          {"[=     ]"},
+          {"[==    ]"},
+          {"[===   ]"},
+          {"[====  ]"},
+          {"[===== ]"},
+          {"[======]"},
+          {"[ =====]"},
+          {"[  ====]"},
+          {"[   ===]"},
+          {"[    ==]"},
+          {"[     =]"},
+      },
+      {
+          {"[==    ]"},
+          {"[==    ]"},
+          {"[==    ]"},
+          {"[==    ]"},
+          {"[==    ]"},
+          {" [==   ]"},
+          {"[  ==  ]"},
+          {"[   == ]"},
+          {"[    ==]"},
+          {"[    ==]"},
+          {"[    ==]"},
+          {"[    ==]"},
+          {"[    ==]"},
+          {"[   ==] "},
+          {"[  ==  ]"},
+          {"[ ==   ]"},
+      },
+      {
+          {
+              " ─╮",
+              "  │",
+              "   ",
+          },
+          {
+              "  ╮",
+              "  │",
+              "  ╯",
+          },
+          {
+              "   ",
+              "  │",
+              " ─╯",
+          },
+          {
+              "   ",
+              "   ",
+              "╰─╯",
+          },
+          {
+              "   ",
+              "│  ",
+              "╰─ ",
+          },
+          {
+              "╭  ",
+              "│  ",
+              "╰  ",
+          },
+          {
+              "╭─ ",
+              "│  ",
+              "   ",
+          },
+          {
+              "╭─╮",
+              "   ",
+              "   ",
+          },
+      },
+      {
+          {
+              "   /\\O ",
+              "    /\\/",
+              "   /\\  ",
+              "  /  \\ ",
+              "LOL  LOL",
+          },
+          {
+              "    _O  ",
+              "   //|_ ",
+              "    |   ",
+              "   /|   ",
+              "   LLOL ",
+          },
+          {
+              "     O  ",
+              "    /_  ",
+              "    |\\  ",
+              "   / |  ",
+              " LOLLOL ",
+          },
+      },
+      {
+          {"       ", "_______", "       "},
+          {"       ", "______/", "       "},
+          {"      _", "_____/ ", "       "},
+          {"     _ ", "____/ \\", "       "},
+          {"    _  ", "___/ \\ ", "      \\"},
+          {"   _   ", "__/ \\  ", "     \\_"},
+          {"  _    ", "_/ \\   ", "    \\_/"},
+          {" _     ", "/ \\   _", "   \\_/ "},
+          {"_      ", " \\   __", "  \\_/  "},
+          {"       ", "\\   ___", " \\_/   "},
+          {"       ", "    ___", "\\_/    "},
+          {"       ", "  _____", "_/     "},
+          {"       ", " ______", "/      "},
+          {"       ", "_______", "       "},
+      },
+  };
+  return elements;
+}
 
 }  // namespace
 
@@ -288,6 +292,7 @@ Element spinner(int charset_index, size_t image_index) {
     }
     return gauge(float(image_index) * 0.05F);  // NOLINT
   }
+  const auto& elements = Frames();
   charset_index %= int(elements.size());
   image_index %= int(elements[charset_index].size());
   std::vector<Element> lines;
@@ -0,0 +1,478 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/dom/element_arena.hpp"  // for MakeElement
+#include "ftxui/dom/styled_text.hpp"
+
+#include <algorithm>    // for min
+#include <array>        // for array
+#include <cstddef>      // for size_t
+#include <memory>       // for make_shared
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <utility>      // for move
+#include <vector>       // for vector
+
+#include "ftxui/dom/elements.hpp"   // for Element, styledText, ansiText
+#include "ftxui/dom/node.hpp"       // for Node
+#include "ftxui/dom/selection.hpp"  // for Selection
+#include "ftxui/screen/box.hpp"     // for Box
+#include "ftxui/screen/screen.hpp"  // for Screen
+#include "ftxui/screen/string.hpp"  // for Glyph, Glyphs
+#include "ftxui/util/ref.hpp"       // for ConstRef
+
+namespace ftxui {
+
+namespace {
+
+class StyledTextNode : public Node {
+ public:
+  explicit StyledTextNode(ConstRef<StyledText> text) : text_(std::move(text)) {}
+
+  void ComputeRequirement() override {
+    requirement_.min_x = text_->width();
+    requirement_.min_y = 1;
+    has_selection_ = false;
+  }
+
+  void Select(Selection& selection) override {
+    if (Box::Intersection(selection.GetBox(), box_).IsEmpty()) {
+      return;
+    }
+
+    const Selection selection_saturated = selection.SaturateHorizontal(box_);
+
+    has_selection_ = true;
+    selection_start_ = selection_saturated.GetBox().x_min;
+    selection_end_ = selection_saturated.GetBox().x_max;
+
+    std::string selected;
+    int x = box_.x_min;
+    for (const Glyph& glyph : Glyphs(text_->text())) {
+      if (glyph.value[0] == '\n') {
+        continue;
+      }
+      if (selection_start_ <= x && x <= selection_end_) {
+        selected += glyph.value;
+      }
+      x += glyph.width;
+    }
+    selection.AddPart(selected, box_.y_min, selection_start_, selection_end_);
+  }
+
+  void Render(Screen& screen) override {
+    int x = box_.x_min;
+    const int y = box_.y_min;
+    if (y > box_.y_max) {
+      return;
+    }
+
+    const std::vector<StyledText::Run>& runs = text_->runs();
+    const std::vector<StyledText::Style>& styles = text_->styles();
+    auto run = runs.begin();
+
+    const GlyphRange glyphs = Glyphs(text_->text());
+    for (auto it = glyphs.begin(); it != glyphs.end(); ++it) {
+      if (it->value[0] == '\n') {
+        continue;
+      }
+
+      // The runs and the glyphs are both sorted by position.
+      const size_t position = it.position();
+      while (run != runs.end() && run->offset + run->length <= position) {
+        ++run;
+      }
+      const StyledText::Style* style =
+          run != runs.end() && run->offset <= position ? &styles[run->style]
+                                                       : nullptr;
+
+      // Fullwidth glyphs take two cells. The second is left empty.
+      for (int i = 0; i < it->width; ++i) {
+        if (x > box_.x_max) {
+          return;
+        }
+        Pixel& pixel = screen.PixelAt(x, y);
+        pixel.character = i == 0 ? it->value : "";
+        if (style) {
+          style->Apply(pixel);
+        }
+        if (has_selection_ && x >= selection_start_ && x <= selection_end_) {
+          screen.GetSelectionStyle()(pixel);
+        }
+        ++x;
+      }
+    }
+  }
+
+ private:
+  ConstRef<StyledText> text_;
+  bool has_selection_ = false;
+  int selection_start_ = 0;
+  int selection_end_ = -1;
+};
+
+// A sequence longer than this is considered malformed, instead of waiting
+// forever for its end.
+constexpr size_t kMaxEscapeSequence = 4096;
+
+// Return the end of the escape sequence starting at |start|, or npos if it is
+// cut by the end of |text|.
+size_t EscapeEnd(std::string_view text, size_t start) {
+  const size_t limit = std::min(text.size(), start + kMaxEscapeSequence);
+  if (start + 1 >= limit) {
+    return limit == text.size() ? std::string_view::npos : start + 1;
+  }
+
+  switch (text[start + 1]) {
+    // CSI: parameter and intermediate bytes, then a final byte.
+    case '[':
+      for (size_t i = start + 2; i < limit; ++i) {
+        const auto c = static_cast<unsigned char>(text[i]);
+        if (c >= 0x40 && c <= 0x7E) {
+          return i + 1;
+        }
+        if (c < 0x20 || c > 0x3F) {
+          return i;  // Malformed.
+        }
+      }
+      break;
+
+    // OSC: terminated by BEL or ST.
+    case ']':
+      for (size_t i = start + 2; i < limit; ++i) {
+        if (text[i] == '\a') {
+          return i + 1;
+        }
+        if (text[i] == '\x1B') {
+          if (i + 1 == text.size()) {
+            return std::string_view::npos;
+          }
+          return text[i + 1] == '\\' ? i + 2 : i;
+        }
+      }
+      break;
+
+    // nF: intermediate bytes, then a final byte. For instance "ESC ( B"
+    // selects the ASCII character set.
+    default:
+      for (size_t i = start + 1; i < limit; ++i) {
+        const auto c = static_cast<unsigned char>(text[i]);
+        if (c < 0x20 || c > 0x2F) {
+          return i + 1;
+        }
+      }
+      break;
+  }
+
+  return limit == text.size() ? std::string_view::npos : limit;
+}
+
+// Apply the parameters of a SGR sequence, like "1;31", to |style|.
+//
+// The parameters are separated by ';'. A parameter can be made of
+// sub-parameters separated by ':', like "38:2::255:0:0". They are parsed as a
+// group.
+void ApplySgr(std::string_view parameters, StyledText::Style& style) {
+  std::array<int, 16> values = {};
+  std::array<bool, 16> sub_parameter = {};  // Follows a ':'.
+  size_t count = 1;
+  for (const char c : parameters) {
+    if (c == ';' || c == ':') {
+      if (count == values.size()) {
+        break;
+      }
+      sub_parameter[count] = (c == ':');
+      ++count;
+    } else if (c >= '0' && c <= '9') {
+      int& value = values[count - 1];
+      value = std::min(value * 10 + (c - '0'), 0xFFFF);
+    }
+  }
+
+  // The sub-parameters of the group starting at |i|.
+  auto group_size = [&](size_t i) {
+    size_t size = 1;
+    while (i + size < count && sub_parameter[i + size]) {
+      ++size;
+    }
+    return size;
+  };
+
+  // "38;5;n" or "38;2;r;g;b", the parameters being separated by ';'.
+  auto extended_color = [&](size_t& i) -> Color {
+    if (i + 2 < count && values[i + 1] == 5) {
+      i += 2;
+      return Color(static_cast<Color::Palette256>(values[i] & 0xFF));
+    }
+    if (i + 4 < count && values[i + 1] == 2) {
+      i += 4;
+      return Color::RGB(static_cast<uint8_t>(values[i - 2]),
+                        static_cast<uint8_t>(values[i - 1]),
+                        static_cast<uint8_t>(values[i]));
+    }
+    i = count;  // Malformed: ignore the rest.
+    return Color::Default;
+  };
+
+  // "38:5:n", "38:2:r:g:b" or "38:2:colorspace:r:g:b", as a single group.
+  auto extended_color_group = [&](size_t i, size_t size) -> Color {
+    const int* group = &values[i];
+    if (size >= 3 && group[1] == 5) {
+      return Color(static_cast<Color::Palette256>(group[2] & 0xFF));
+    }
+    if (size >= 5 && group[1] == 2) {
+      const size_t r = size >= 6 ? 3 : 2;
+      return Color::RGB(static_cast<uint8_t>(group[r]),
+                        static_cast<uint8_t>(group[r + 1]),
+                        static_cast<uint8_t>(group[r + 2]));
+    }
+    return Color::Default;
+  };
+
+  for (size_t i = 0; i < count; ++i) {
+    const size_t size = group_size(i);
+    if (size > 1) {
+      switch (values[i]) {
+        case 38:
+          style.foreground_color = extended_color_group(i, size);
+          break;
+        case 48:
+          style.background_color = extended_color_group(i, size);
+          break;
+        case 4:
+          // The underline style: "4:0" is none, "4:2" is double. The others,
+          // like curly ones, are drawn as a single underline.
+          style.underlined = values[i + 1] != 0 && values[i + 1] != 2;
+          style.underlined_double = values[i + 1] == 2;
+          break;
+        default:
+          break;
+      }
+      i += size - 1;
+      continue;
+    }
+
+    const int value = values[i];
+    switch (value) {
+      // clang-format off
+      case 0: style = StyledText::Style(); break;
+      case 1: style.bold = true; break;
+      case 2: style.dim = true; break;
+      case 3: style.italic = true; break;
+      case 4: style.underlined = true; break;
+      case 5: case 6: style.blink = true; break;
+      case 7: style.inverted = true; break;
+      case 9: style.strikethrough = true; break;
+      case 21: style.underlined_double = true; break;
+      case 22: style.bold = false; style.dim = false; break;
+      case 23: style.italic = false; break;
+      case 24: style.underlined = false; style.underlined_double = false; break;
+      case 25: style.blink = false; break;
+      case 27: style.inverted = false; break;
+      case 29: style.strikethrough = false; break;
+      case 38: style.foreground_color = extended_color(i); break;
+      case 39: style.foreground_color = Color::Default; break;
+      case 48: style.background_color = extended_color(i); break;
+      case 49: style.background_color = Color::Default; break;
+      // clang-format on
+      default:
+        if (value >= 30 && value <= 37) {
+          style.foreground_color = static_cast<Color::Palette16>(value - 30);
+        } else if (value >= 40 && value <= 47) {
+          style.background_color = static_cast<Color::Palette16>(value - 40);
+        } else if (value >= 90 && value <= 97) {
+          style.foreground_color = static_cast<Color::Palette16>(value - 82);
+        } else if (value >= 100 && value <= 107) {
+          style.background_color = static_cast<Color::Palette16>(value - 92);
+        }
+        break;
+    }
+  }
+}
+
+}  // namespace
+
+void StyledText::Style::Apply(Pixel& pixel) const {
+  if (foreground_color != Color::Default) {
+    pixel.foreground_color = foreground_color;
+  }
+  if (background_color != Color::Default) {
+    pixel.background_color = background_color;
+  }
+  if (bold) {
+    pixel.bold = true;
+  }
+  if (dim) {
+    pixel.dim = true;
+  }
+  if (italic) {
+    pixel.italic = true;
+  }
+  if (underlined) {
+    pixel.underlined = true;
+  }
+  if (underlined_double) {
+    pixel.underlined_double = true;
+  }
+  if (blink) {
+    pixel.blink = true;
+  }
+  if (inverted) {
+    pixel.inverted = true;
+  }
+  if (strikethrough) {
+    pixel.strikethrough = true;
+  }
+}
+
+bool StyledText::Style::operator==(const Style& other) const {
+  return foreground_color == other.foreground_color &&
+         background_color == other.background_color && bold == other.bold &&
+         dim == other.dim && italic == other.italic &&
+         underlined == other.underlined &&
+         underlined_double == other.underlined_double && blink == other.blink &&
+         inverted == other.inverted && strikethrough == other.strikethrough;
+}
+
+StyledText::StyledText(std::string_view text) {
+  Append(text);
+}
+
+/// @brief Append |text|, without style.
+StyledText& StyledText::Append(std::string_view text) {
+  if (text.empty()) {
+    return *this;
+  }
+  text_ += text;
+
+  // A codepoint or a glyph can be cut between two appends. Measure again from
+  // a glyph starting before the last incomplete codepoint (3 bytes at most)
+  // of the previous text.
+  const size_t begin = measured_;
+  const GlyphRange glyphs = Glyphs(std::string_view(text_).substr(begin));
+  int width = measured_width_;
+  for (auto it = glyphs.begin(); it != glyphs.end(); ++it) {
+    const size_t position = begin + it.position();
+    if (position + 3 <= text_.size()) {
+      measured_ = position;
+      measured_width_ = width;
+    }
+    width += it->width;
+  }
+  width_ = width;
+  return *this;
+}
+
+/// @brief Append |text|, drawn with |style|.
+StyledText& StyledText::Append(std::string_view text, const Style& style) {
+  if (text.empty()) {
+    return *this;
+  }
+
+  // Styles are few and reused by many runs.
+  uint32_t index = 0;
+  while (index < styles_.size() && styles_[index] != style) {
+    ++index;
+  }
+  if (index == styles_.size()) {
+    styles_.push_back(style);
+  }
+
+  const auto offset = static_cast<uint32_t>(text_.size());
+  const auto length = static_cast<uint32_t>(text.size());
+  if (!runs_.empty() && runs_.back().style == index &&
+      runs_.back().offset + runs_.back().length == offset) {
+    runs_.back().length += length;
+  } else {
+    runs_.push_back({offset, length, index});
+  }
+
+  return Append(text);
+}
+
+/// @brief Append |text|, drawn with |foreground_color|.
+StyledText& StyledText::Append(std::string_view text, Color foreground_color) {
+  Style style;
+  style.foreground_color = foreground_color;
+  return Append(text, style);
+}
+
+/// @brief Remove the text and its styles.
+void StyledText::Clear() {
+  text_.clear();
+  runs_.clear();
+  styles_.clear();
+  width_ = 0;
+  measured_ = 0;
+  measured_width_ = 0;
+  ansi_style_ = Style();
+  ansi_pending_.clear();
+}
+
+/// @brief Append |text|, containing ANSI escape sequences. The SGR sequences
+/// (colors and attributes) style the text that follows them. The other
+/// sequences are dropped.
+///
+/// A sequence cut by the end of |text| is completed by the next call. The
+/// output of a program can be appended as it is read.
+StyledText& StyledText::AppendAnsi(std::string_view text) {
+  std::string joined;
+  if (!ansi_pending_.empty()) {
+    joined = std::move(ansi_pending_);
+    ansi_pending_.clear();
+    joined += text;
+    text = joined;
+  }
+
+  size_t position = 0;
+  while (position < text.size()) {
+    const size_t escape = text.find('\x1B', position);
+    const std::string_view plain = text.substr(position, escape - position);
+    if (ansi_style_ == Style()) {
+      Append(plain);
+    } else {
+      Append(plain, ansi_style_);
+    }
+    if (escape == std::string_view::npos) {
+      break;
+    }
+
+    const size_t end = EscapeEnd(text, escape);
+    if (end == std::string_view::npos) {
+      ansi_pending_ = text.substr(escape);
+      break;
+    }
+    if (text[escape + 1] == '[' && text[end - 1] == 'm') {
+      ApplySgr(text.substr(escape + 2, end - escape - 3), ansi_style_);
+    }
+    position = end;
+  }
+  return *this;
+}
+
+/// @brief Display a StyledText, or a reference to a StyledText. Passing a
+/// reference avoids copying large texts on every frame.
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// StyledText log;
+/// log.Append("[error] ", Color::Red);
+/// log.Append("file not found");
+/// Element document = styledText(&log);
+/// ```
+// NOLINTNEXTLINE
+Element styledText(ConstRef<StyledText> text) {
+  return MakeElement<StyledTextNode>(std::move(text));
+}
+
+/// @brief Display a piece of text containing ANSI escape sequences, like the
+/// output of a compiler. Its colors and attributes are kept.
+/// @ingroup dom
+/// @see StyledText::AppendAnsi
+Element ansiText(std::string_view text) {
+  return styledText(StyledText().AppendAnsi(text));
+}
+
+}  // namespace ftxui
@@ -0,0 +1,16 @@
+/// @module ftxui.dom.styled_text
+/// @brief Module file for the StyledText struct of the Dom module
+
+module;
+
+#include <ftxui/dom/styled_text.hpp>
+
+export module ftxui.dom.styled_text;
+
+/**
+ * @namespace ftxui
+ * @brief The FTXUI ftxui:: namespace
+ */
+export namespace ftxui {
+    using ftxui::StyledText;
+}
@@ -0,0 +1,250 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <string>  // for allocator, string
+
+#include "ftxui/dom/element_arena.hpp"  // for ElementArena
+#include "ftxui/dom/elements.hpp"     // for styledText, Element
+#include "ftxui/dom/node.hpp"         // for Render
+#include "ftxui/dom/styled_text.hpp"  // for StyledText
+#include "ftxui/screen/color.hpp"     // for Color
+#include "ftxui/screen/screen.hpp"    // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+TEST(StyledTextTest, Runs) {
+  StyledText::Style bold;
+  bold.bold = true;
+
+  StyledText text;
+  text.Append("ab", Color::Red);
+  text.Append("cd", Color::Red);
+  text.Append("e");
+  text.Append("测", bold);
+  text.Append("f", Color::Red);
+
+  EXPECT_EQ(text.text(), "abcde测f");
+  EXPECT_EQ(text.width(), 8);
+
+  // Adjacent runs of the same style are merged, and styles are shared.
+  ASSERT_EQ(text.runs().size(), 3u);
+  EXPECT_EQ(text.runs()[0].offset, 0u);
+  EXPECT_EQ(text.runs()[0].length, 4u);
+  EXPECT_EQ(text.runs()[1].offset, 5u);
+  EXPECT_EQ(text.runs()[1].length, 3u);
+  EXPECT_EQ(text.runs()[2].style, text.runs()[0].style);
+  EXPECT_EQ(text.styles().size(), 2u);
+
+  text.Clear();
+  EXPECT_EQ(text.text(), "");
+  EXPECT_EQ(text.width(), 0);
+  EXPECT_TRUE(text.runs().empty());
+}
+
+TEST(StyledTextTest, Render) {
+  StyledText::Style bold;
+  bold.bold = true;
+
+  StyledText text("a");
+  text.Append("测", bold);
+  text.Append("b", Color::Red);
+
+  Screen screen(5, 1);
+  Render(screen, styledText(&text));
+  EXPECT_EQ(screen.at(0, 0), "a");
+  EXPECT_EQ(screen.at(1, 0), "测");
+  EXPECT_EQ(screen.at(2, 0), "");
+  EXPECT_EQ(screen.at(3, 0), "b");
+  EXPECT_FALSE(screen.PixelAt(0, 0).bold);
+  EXPECT_TRUE(screen.PixelAt(1, 0).bold);
+  EXPECT_TRUE(screen.PixelAt(2, 0).bold);
+  EXPECT_FALSE(screen.PixelAt(3, 0).bold);
+  EXPECT_EQ(screen.PixelAt(3, 0).foreground_color, Color(Color::Red));
+  EXPECT_EQ(screen.PixelAt(0, 0).foreground_color, Color(Color::Default));
+}
+
+TEST(StyledTextTest, KeepDecoratorStyle) {
+  StyledText text;
+  text.Append("a");
+  text.Append("b", Color::Red);
+
+  Screen screen(2, 1);
+  Render(screen, styledText(text) | color(Color::Blue) | bold);
+  EXPECT_EQ(screen.PixelAt(0, 0).foreground_color, Color(Color::Blue));
+  EXPECT_EQ(screen.PixelAt(1, 0).foreground_color, Color(Color::Red));
+  EXPECT_TRUE(screen.PixelAt(1, 0).bold);
+}
+
+TEST(StyledTextTest, ScreenSmaller) {
+  StyledText text;
+  text.Append("test", Color::Red);
+  Screen screen(2, 1);
+  Render(screen, styledText(text));
+  EXPECT_EQ("\x1B[31;49mte\x1B[39;49m", screen.ToString());
+}
+
+TEST(StyledTextTest, AppendAnsi) {
+  StyledText text;
+  text.AppendAnsi("a\x1B[1;31mb\x1B[22mc\x1B[0m\x1B[Kd");
+  EXPECT_EQ(text.text(), "abcd");
+  ASSERT_EQ(text.runs().size(), 2u);
+  EXPECT_EQ(text.runs()[0].offset, 1u);
+  EXPECT_EQ(text.runs()[0].length, 1u);
+  EXPECT_EQ(text.runs()[1].offset, 2u);
+  EXPECT_EQ(text.runs()[1].length, 1u);
+
+  const StyledText::Style& b = text.styles()[text.runs()[0].style];
+  EXPECT_TRUE(b.bold);
+  EXPECT_EQ(b.foreground_color, Color(Color::Red));
+  const StyledText::Style& c = text.styles()[text.runs()[1].style];
+  EXPECT_FALSE(c.bold);
+  EXPECT_EQ(c.foreground_color, Color(Color::Red));
+}
+
+TEST(StyledTextTest, AppendAnsiColors) {
+  StyledText text;
+  text.AppendAnsi("\x1B[38;5;208;48;2;1;2;3ma\x1B[94;101mb\x1B[39;49m");
+  ASSERT_EQ(text.runs().size(), 2u);
+  const StyledText::Style& a = text.styles()[text.runs()[0].style];
+  EXPECT_EQ(a.foreground_color, Color(Color::DarkOrange));
+  EXPECT_EQ(a.background_color, Color::RGB(1, 2, 3));
+  const StyledText::Style& b = text.styles()[text.runs()[1].style];
+  EXPECT_EQ(b.foreground_color, Color(Color::BlueLight));
+  EXPECT_EQ(b.background_color, Color(Color::RedLight));
+}
+
+TEST(StyledTextTest, AppendAnsiStreaming) {
+  // The escape sequences are cut between two appends.
+  StyledText text;
+  text.AppendAnsi("a\x1B");
+  text.AppendAnsi("[3");
+  text.AppendAnsi("1mb\x1B]8;;http://example.com\x1B");
+  text.AppendAnsi("\\c");
+  EXPECT_EQ(text.text(), "abc");
+  ASSERT_EQ(text.runs().size(), 1u);
+  EXPECT_EQ(text.runs()[0].offset, 1u);
+  EXPECT_EQ(text.runs()[0].length, 2u);
+}
+
+TEST(StyledTextTest, AppendAnsiCharsetSelection) {
+  // "tput sgr0" emits "ESC ( B" to select the ASCII character set.
+  StyledText text;
+  text.AppendAnsi("a\x1B(Bb\x1B[31mc\x1B(B\x1B[mde\x1B(");
+  text.AppendAnsi("0f\x1B" "7g");
+  EXPECT_EQ(text.text(), "abcdefg");
+  ASSERT_EQ(text.runs().size(), 1u);
+  EXPECT_EQ(text.runs()[0].offset, 2u);
+  EXPECT_EQ(text.runs()[0].length, 1u);
+}
+
+TEST(StyledTextTest, AppendAnsiColonParameters) {
+  StyledText text;
+  text.AppendAnsi("\x1B[38:2::10:20:30;48:5:208ma");
+  text.AppendAnsi("\x1B[0;38:2:40:50:60;1;4:3mb");
+  text.AppendAnsi("\x1B[4:0;4:2mc");
+  ASSERT_EQ(text.runs().size(), 3u);
+
+  const StyledText::Style& a = text.styles()[text.runs()[0].style];
+  EXPECT_EQ(a.foreground_color, Color::RGB(10, 20, 30));
+  EXPECT_EQ(a.background_color, Color(Color::DarkOrange));
+
+  const StyledText::Style& b = text.styles()[text.runs()[1].style];
+  EXPECT_EQ(b.foreground_color, Color::RGB(40, 50, 60));
+  EXPECT_EQ(b.background_color, Color::Default);
+  EXPECT_TRUE(b.bold);
+  EXPECT_TRUE(b.underlined);
+
+  const StyledText::Style& c = text.styles()[text.runs()[2].style];
+  EXPECT_FALSE(c.underlined);
+  EXPECT_TRUE(c.underlined_double);
+}
+
+TEST(StyledTextTest, AppendWidthAcrossChunks) {
+  // "é", cut in the middle of its encoding.
+  StyledText codepoint;
+  codepoint.Append("a\xC3");
+  codepoint.Append("\xA9" "b");
+  EXPECT_EQ(codepoint.width(), 3);
+
+  // A family emoji, cut after a zero width joiner.
+  const std::string family = "\U0001F468\u200D\U0001F469\u200D\U0001F467";
+  StyledText sequence;
+  sequence.Append(family.substr(0, 7));
+  sequence.Append(family.substr(7, 5));
+  sequence.Append(family.substr(12));
+  EXPECT_EQ(sequence.width(), StyledText(family).width());
+  EXPECT_EQ(sequence.width(), 2);
+
+  // The bytes are streamed one by one.
+  const std::string mixed = "x" + family + "\u00E9y\U0001F1EB\U0001F1F7z";
+  StyledText streamed;
+  for (const char c : mixed) {
+    streamed.AppendAnsi(std::string(1, c));
+  }
+  EXPECT_EQ(streamed.text(), mixed);
+  EXPECT_EQ(streamed.width(), StyledText(mixed).width());
+  EXPECT_EQ(streamed.width(), 8);
+}
+
+TEST(StyledTextTest, AnsiText) {
+  Screen screen(3, 1);
+  Render(screen, ansiText("a\x1B[31mbc\x1B[0m"));
+  EXPECT_EQ("a\x1B[31;49mbc\x1B[39;49m", screen.ToString());
+}
+
+TEST(StyledTextTest, AnsiParagraph) {
+  Screen screen(5, 4);
+  Render(screen, ansiParagraph("\x1B[1maaa bbb\x1B[0m\n\ncc"));
+  EXPECT_EQ(screen.at(0, 0), "a");
+  EXPECT_EQ(screen.at(0, 1), "b");
+  EXPECT_EQ(screen.at(0, 3), "c");
+  EXPECT_TRUE(screen.PixelAt(0, 1).bold);
+  EXPECT_FALSE(screen.PixelAt(0, 3).bold);
+}
+
+TEST(StyledTextTest, StyledParagraphWrap) {
+  // A style spanning several words, and a word with several styles.
+  StyledText text;
+  text.Append("one ");
+  text.Append("two three", Color::Red);
+  text.Append(" fo");
+  text.Append("ur", Color::Blue);
+
+  Screen screen(9, 3);
+  Render(screen, styledParagraph(text));
+  EXPECT_EQ(screen.at(0, 0), "o");
+  EXPECT_EQ(screen.PixelAt(0, 0).foreground_color, Color::Default);
+  EXPECT_EQ(screen.at(4, 0), "t");
+  EXPECT_EQ(screen.PixelAt(4, 0).foreground_color, Color::Red);
+  EXPECT_EQ(screen.at(0, 1), "t");
+  EXPECT_EQ(screen.PixelAt(4, 1).foreground_color, Color::Red);
+  EXPECT_EQ(screen.at(0, 2), "f");
+  EXPECT_EQ(screen.PixelAt(1, 2).foreground_color, Color::Default);
+  EXPECT_EQ(screen.PixelAt(2, 2).foreground_color, Color::Blue);
+  EXPECT_EQ(screen.PixelAt(3, 2).foreground_color, Color::Blue);
+}
+
+TEST(StyledTextTest, StyledParagraphIsASingleNode) {
+  StyledText text;
+  for (int i = 0; i < 100; ++i) {
+    text.Append("word ", i % 2 ? Color::Red : Color::Blue);
+  }
+
+  ElementArena arena;
+  {
+    ElementArena::Scope scope(&arena);
+    auto document = styledParagraph(text);
+    EXPECT_EQ(arena.live(), 1u);
+
+    Screen screen(10, 50);
+    Render(screen, document);
+    EXPECT_EQ(screen.at(0, 49), "w");
+    EXPECT_EQ(screen.PixelAt(0, 49).foreground_color, Color::Blue);
+  }
+  arena.Release();
+}
+
+}  // namespace ftxui
+// NOLINTEND
@@ -6,6 +6,8 @@
 #include <algorithm>         // for max
 #include <initializer_list>  // for initializer_list
 #include <memory>   // for allocator, shared_ptr, allocator_traits<>::value_type
+#include <string>       // for string
+#include <string_view>  // for string_view
 #include <utility>  // for move, swap
 #include <vector>   // for vector
 
@@ -19,7 +21,7 @@ bool IsCell(int x, int y) {
 }
 
 // NOLINTNEXTLINE
-static std::string charset[6][6] = {
+constexpr std::string_view charset[6][6] = {
     {"┌", "┐", "└", "┘", "─", "│"},  // LIGHT
     {"┏", "┓", "┗", "┛", "╍", "╏"},  // DASHED
     {"┏", "┓", "┗", "┛", "━", "┃"},  // HEAVY
@@ -348,13 +350,17 @@ void TableSelection::Border(BorderStyle border) {
   BorderBottom(border);
 
   // NOLINTNEXTLINE
-  table_->elements_[y_min_][x_min_] = text(charset[border][0]) | automerge;
+  table_->elements_[y_min_][x_min_] =
+      text(std::string(charset[border][0])) | automerge;
   // NOLINTNEXTLINE
-  table_->elements_[y_min_][x_max_] = text(charset[border][1]) | automerge;
+  table_->elements_[y_min_][x_max_] =
+      text(std::string(charset[border][1])) | automerge;
   // NOLINTNEXTLINE
-  table_->elements_[y_max_][x_min_] = text(charset[border][2]) | automerge;
+  table_->elements_[y_max_][x_min_] =
+      text(std::string(charset[border][2])) | automerge;
   // NOLINTNEXTLINE
-  table_->elements_[y_max_][x_max_] = text(charset[border][3]) | automerge;
+  table_->elements_[y_max_][x_max_] =
+      text(std::string(charset[border][3])) | automerge;
 }
 
 /// @brief Draw some separator lines in the selection.
@@ -364,9 +370,9 @@ void TableSelection::Separator(BorderStyle border) {
     for (int x = x_min_ + 1; x <= x_max_ - 1; ++x) {
       if (y % 2 == 0 || x % 2 == 0) {
         Element& e = table_->elements_[y][x];
-        e = (y % 2 == 1)
-                ? separatorCharacter(charset[border][5]) | automerge   // NOLINT
-                : separatorCharacter(charset[border][4]) | automerge;  // NOLINT
+        // NOLINTNEXTLINE
+        const std::string_view c = charset[border][(y % 2 == 1) ? 5 : 4];
+        e = separatorCharacter(std::string(c)) | automerge;
       }
     }
   }
@@ -378,8 +384,9 @@ void TableSelection::SeparatorVertical(BorderStyle border) {
   for (int y = y_min_ + 1; y <= y_max_ - 1; ++y) {
     for (int x = x_min_ + 1; x <= x_max_ - 1; ++x) {
       if (x % 2 == 0) {
+        // NOLINTNEXTLINE
         table_->elements_[y][x] =
-            separatorCharacter(charset[border][5]) | automerge;  // NOLINT
+            separatorCharacter(std::string(charset[border][5])) | automerge;
       }
     }
   }
@@ -391,8 +398,9 @@ void TableSelection::SeparatorHorizontal(BorderStyle border) {
   for (int y = y_min_ + 1; y <= y_max_ - 1; ++y) {
     for (int x = x_min_ + 1; x <= x_max_ - 1; ++x) {
       if (y % 2 == 0) {
+        // NOLINTNEXTLINE
         table_->elements_[y][x] =
-            separatorCharacter(charset[border][4]) | automerge;  // NOLINT
+            separatorCharacter(std::string(charset[border][4])) | automerge;
       }
     }
   }
@@ -402,8 +410,9 @@ void TableSelection::SeparatorHorizontal(BorderStyle border) {
 /// @param border The border style to apply.
 void TableSelection::BorderLeft(BorderStyle border) {
   for (int y = y_min_; y <= y_max_; y++) {
+    // NOLINTNEXTLINE
     table_->elements_[y][x_min_] =
-        separatorCharacter(charset[border][5]) | automerge;  // NOLINT
+        separatorCharacter(std::string(charset[border][5])) | automerge;
   }
 }
 
@@ -411,8 +420,9 @@ void TableSelection::BorderLeft(BorderStyle border) {
 /// @param border The border style to apply.
 void TableSelection::BorderRight(BorderStyle border) {
   for (int y = y_min_; y <= y_max_; y++) {
+    // NOLINTNEXTLINE
     table_->elements_[y][x_max_] =
-        separatorCharacter(charset[border][5]) | automerge;  // NOLINT
+        separatorCharacter(std::string(charset[border][5])) | automerge;
   }
 }
 
@@ -420,8 +430,9 @@ void TableSelection::BorderRight(BorderStyle border) {
 /// @param border The border style to apply.
 void TableSelection::BorderTop(BorderStyle border) {
   for (int x = x_min_; x <= x_max_; x++) {
+    // NOLINTNEXTLINE
     table_->elements_[y_min_][x] =
-        separatorCharacter(charset[border][4]) | automerge;  // NOLINT
+        separatorCharacter(std::string(charset[border][4])) | automerge;
   }
 }
 
@@ -429,8 +440,9 @@ void TableSelection::BorderTop(BorderStyle border) {
 /// @param border The border style to apply.
 void TableSelection::BorderBottom(BorderStyle border) {
   for (int x = x_min_; x <= x_max_; x++) {
+    // NOLINTNEXTLINE
     table_->elements_[y_max_][x] =
-        separatorCharacter(charset[border][4]) | automerge;  // NOLINT
+        separatorCharacter(std::string(charset[border][4])) | automerge;
   }
 }
 
@@ -3,18 +3,20 @@
 // the LICENSE file.
 #include <algorithm>  // for min
 #include <memory>     // for make_shared
-#include <string>   // for string, wstring
-#include <utility>  // for move
-
-#include "ftxui/dom/deprecated.hpp"   // for text, vtext
-#include "ftxui/dom/elements.hpp"     // for Element, text, vtext
-#include "ftxui/dom/node.hpp"         // for Node
-#include "ftxui/dom/requirement.hpp"  // for Requirement
-#include "ftxui/dom/selection.hpp"    // for Selection
-#include "ftxui/screen/box.hpp"       // for Box
-#include "ftxui/screen/colored_string.hpp"
-#include "ftxui/screen/screen.hpp"    // for Pixel, Screen
-#include "ftxui/screen/string.hpp"  // for string_width, Utf8ToGlyphs, to_string
+#include <string>       // for string, wstring
+#include <string_view>  // for string_view
+#include <utility>      // for move
+
+#include "ftxui/dom/deprecated.hpp"      // for text, vtext
+#include "ftxui/dom/element_arena.hpp"   // for MakeElement
+#include "ftxui/dom/elements.hpp"        // for Element, text, vtext
+#include "ftxui/dom/node.hpp"            // for Node
+#include "ftxui/dom/requirement.hpp"     // for Requirement
+#include "ftxui/dom/selection.hpp"       // for Selection
+#include "ftxui/screen/box.hpp"          // for Box
+#include "ftxui/screen/glyph_cache.hpp"  // for GlyphCache, GlyphLayout
+#include "ftxui/screen/screen.hpp"       // for Pixel, Screen
+#include "ftxui/screen/string.hpp"       // for string_width, Glyphs, to_string
 
 namespace ftxui {
 
@@ -23,16 +25,23 @@ using ftxui::Screen;
 
 class Text : public Node {
  public:
-  explicit Text(std::string text) : textOwn_(std::move(text)), textPtr_(&textOwn_) {}
+  explicit Text(std::string text)
+      : textOwn_(std::move(text)), textPtr_(&textOwn_) {
+    cacheable_ = true;
+  }
   explicit Text(const std::string* text) : textPtr_(text) {}
+  Text(const std::string* text, const size_t* generation)
+      : textPtr_(text), generation_(generation) {}
 
   void ComputeRequirement() override {
-    requirement_.min_x = string_width(*textPtr_);
+    Measure();
+    requirement_.min_x = width_;
     requirement_.min_y = 1;
     has_selection = false;
   }
 
   void Select(Selection& selection) override {
+    has_selection = false;
     if (Box::Intersection(selection.GetBox(), box_).IsEmpty()) {
       return;
     }
@@ -43,21 +52,19 @@ class Text : public Node {
     selection_start_ = selection_saturated.GetBox().x_min;
     selection_end_ = selection_saturated.GetBox().x_max;
 
-    std::stringstream ss;
+    std::string selected;
     int x = box_.x_min;
-    for (const auto& cell : Utf8ToGlyphs(*textPtr_)) {
-      if (cell[0] == '\n') {
-        continue;
-      }
-      if (GlyphIsColorSet(cell) || GlyphIsColorReset(cell)) {
-          continue;
+    ForEachGlyph([&](std::string_view value, int width) {
+      if (value[0] == '\n') {
+        return true;
       }
       if (selection_start_ <= x && x <= selection_end_) {
-        ss << cell;
+        selected += value;
       }
-      x++;
-    }
-    selection.AddPart(ss.str(), box_.y_min, selection_start_, selection_end_);
+      x += width;
+      return true;
+    });
+    selection.AddPart(selected, box_.y_min, selection_start_, selection_end_);
   }
 
   void Render(Screen& screen) override {
@@ -68,37 +75,90 @@ class Text : public Node {
       return;
     }
 
-    const Color* color = nullptr;
-
-    for (const auto& cell : Utf8ToGlyphs(*textPtr_)) {
+    ForEachGlyph([&](std::string_view value, int width) {
       if (x > box_.x_max) {
-        break;
+        return false;
       }
-      if (cell[0] == '\n') {
-        continue;
+      if (value[0] == '\n') {
+        return true;
       }
 
-      if (GlyphIsColorSet(cell)) {
-        color = GlyphToColor(cell);
-        continue;
+      PutGlyph(screen, x++, y, value);
+
+      // Fullwidth glyphs take two cells. The second is left empty.
+      if (width == 2 && x <= box_.x_max) {
+        PutGlyph(screen, x++, y, {});
       }
-      else if (GlyphIsColorReset(cell)) {
-        color = nullptr;
-        continue;
+      return true;
+    });
+
+    // The layout may be cached. The selection is set again by Select() on the
+    // next frame.
+    has_selection = false;
+  }
+
+ private:
+  // Measure the width of the text, unless it is known to be unchanged. An
+  // owned text never changes. A referenced one is measured again on every
+  // layout, unless the caller bumps a generation counter on changes.
+  //
+  // Only the width is kept. The glyphs are iterated again when drawing, without
+  // allocating. When the GlyphCache is enabled, identical strings share their
+  // glyphs through it instead.
+  void Measure() {
+    const bool unchanged =
+        textPtr_ == &textOwn_ ||
+        (generation_ && *generation_ == measured_generation_);
+    if (measured_ && unchanged) {
+      return;
+    }
+    measured_ = true;
+    if (generation_) {
+      measured_generation_ = *generation_;
+    }
+
+    if (GlyphCache::Enabled()) {
+      layout_ = GlyphCache::Get(*textPtr_);
+      width_ = layout_->width;
+      return;
+    }
+
+    layout_ = nullptr;
+    width_ = 0;
+    for (const Glyph& glyph : Glyphs(*textPtr_)) {
+      width_ += glyph.width;
+    }
+  }
+
+  // Call |f(value, width)| for every glyph of the text, until it returns
+  // false.
+  template <typename F>
+  void ForEachGlyph(F f) const {
+    if (!layout_) {
+      for (const Glyph& glyph : Glyphs(*textPtr_)) {
+        if (!f(glyph.value, glyph.width)) {
+          return;
+        }
       }
+      return;
+    }
 
-      PutGlyph(screen, x++, y, cell, color);
+    // The layout comes from the cache. The text may have shrunk without its
+    // generation being updated.
+    const std::string_view text = *textPtr_;
+    for (const GlyphLayout::Glyph& glyph : layout_->glyphs) {
+      if (glyph.offset + glyph.size > text.size()) {
+        return;
+      }
+      if (!f(text.substr(glyph.offset, glyph.size), glyph.width)) {
+        return;
+      }
     }
   }
 
- private:
-  void PutGlyph(Screen& screen, int x, int y, const std::string& cell, const Color* color) const {
+  void PutGlyph(Screen& screen, int x, int y, std::string_view cell) const {
       auto& pixel = screen.PixelAt(x, y);
       pixel.character = cell;
-      if (color)
-      {
-        pixel.foreground_color = *color;
-      }
 
       if (has_selection) {
         auto selectionTransform = screen.GetSelectionStyle();
@@ -110,6 +170,11 @@ class Text : public Node {
 
   const std::string textOwn_;
   const std::string* textPtr_;
+  const size_t* generation_ = nullptr;
+  std::shared_ptr<const GlyphLayout> layout_;  // Only with the GlyphCache.
+  int width_ = 0;
+  bool measured_ = false;
+  size_t measured_generation_ = 0;
   bool has_selection = false;
   int selection_start_ = 0;
   int selection_end_ = -1;
@@ -118,11 +183,15 @@ class Text : public Node {
 class VText : public Node {
  public:
   explicit VText(std::string text)
-      : text_(std::move(text)), width_{std::min(string_width(text_), 1)} {}
+      : text_(std::move(text)),
+        height_(string_width(text_)),
+        width_{std::min(height_, 1)} {
+    cacheable_ = true;
+  }
 
   void ComputeRequirement() override {
     requirement_.min_x = width_;
-    requirement_.min_y = string_width(text_);
+    requirement_.min_y = height_;
   }
 
   void Render(Screen& screen) override {
@@ -131,17 +200,20 @@ class VText : public Node {
     if (x + width_ - 1 > box_.x_max) {
       return;
     }
-    for (const auto& it : Utf8ToGlyphs(text_)) {
-      if (y > box_.y_max) {
-        return;
+    for (const Glyph& glyph : Glyphs(text_)) {
+      for (int i = 0; i < glyph.width; ++i) {
+        if (y > box_.y_max) {
+          return;
+        }
+        screen.PixelAt(x, y).character = i == 0 ? glyph.value : "";
+        y += 1;
       }
-      screen.PixelAt(x, y).character = it;
-      y += 1;
     }
   }
 
  private:
   std::string text_;
+  int height_ = 0;
   int width_ = 1;
 };
 
@@ -163,11 +235,33 @@ class VText : public Node {
 /// Hello world!
 /// ```
 Element text(std::string text) {
-  return std::make_shared<Text>(std::move(text));
+  return MakeElement<Text>(std::move(text));
 }
 
+/// @brief Display a piece of UTF8 encoded unicode text, owned by the caller.
+/// The text is measured again on every frame, since it may have changed.
+/// @ingroup dom
 Element text(const std::string* text) {
-  return std::make_shared<Text>(text);
+  return MakeElement<Text>(text);
+}
+
+/// @brief Display a piece of UTF8 encoded unicode text, owned by the caller.
+/// The text is measured only when |generation| changes. The caller must
+/// update it whenever the text is modified.
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// std::string log;
+/// size_t log_generation = 0;
+/// Element document = text(&log, &log_generation);
+///
+/// log += "Hello world!";
+/// log_generation++;
+/// ```
+Element text(const std::string* text, const size_t* generation) {
+  return MakeElement<Text>(text, generation);
 }
 
 /// @brief Display a piece of unicode text.
@@ -186,7 +280,7 @@ Element text(const std::string* text) {
 /// Hello world!
 /// ```
 Element text(std::wstring text) {  // NOLINT
-  return std::make_shared<Text>(to_string(text));
+  return MakeElement<Text>(to_string(text));
 }
 
 /// @brief Display a piece of unicode text vertically.
@@ -216,7 +310,7 @@ Element text(std::wstring text) {  // NOLINT
 /// !
 /// ```
 Element vtext(std::string text) {
-  return std::make_shared<VText>(std::move(text));
+  return MakeElement<VText>(std::move(text));
 }
 
 /// @brief Display a piece unicode text vertically.
@@ -246,7 +340,7 @@ Element vtext(std::string text) {
 /// !
 /// ```
 Element vtext(std::wstring text) {  // NOLINT
-  return std::make_shared<VText>(to_string(text));
+  return MakeElement<VText>(to_string(text));
 }
 
 }  // namespace ftxui
@@ -4,9 +4,10 @@
 #include <gtest/gtest.h>
 #include <string>  // for allocator, string
 
-#include "ftxui/dom/elements.hpp"   // for text, operator|, border, Element
-#include "ftxui/dom/node.hpp"       // for Render
-#include "ftxui/screen/screen.hpp"  // for Screen
+#include "ftxui/dom/elements.hpp"  // for text, operator|, border, Element
+#include "ftxui/dom/node.hpp"      // for Render
+#include "ftxui/screen/glyph_cache.hpp"  // for GlyphCache
+#include "ftxui/screen/screen.hpp"       // for Screen
 
 // NOLINTBEGIN
 namespace ftxui {
@@ -121,5 +122,71 @@ TEST(TextTest, CombiningCharactersWithSpace) {
   EXPECT_EQ(t, screen.ToString());
 }
 
+TEST(TextTest, Pointer) {
+  std::string t = "abc";
+  auto element = text(&t);
+  element->ComputeRequirement();
+  EXPECT_EQ(element->requirement().min_x, 3);
+
+  // Without a generation, the text is measured again on every frame.
+  t = "ab测";
+  element->ComputeRequirement();
+  EXPECT_EQ(element->requirement().min_x, 4);
+
+  Screen screen(4, 1);
+  Render(screen, element);
+  EXPECT_EQ(screen.at(2, 0), "测");
+}
+
+TEST(TextTest, PointerWithGeneration) {
+  std::string t = "abc";
+  size_t generation = 0;
+  auto element = text(&t, &generation);
+  element->ComputeRequirement();
+  EXPECT_EQ(element->requirement().min_x, 3);
+
+  // Until the generation changes, the previous measurement is kept.
+  t = "abcd";
+  element->ComputeRequirement();
+  EXPECT_EQ(element->requirement().min_x, 3);
+
+  generation++;
+  element->ComputeRequirement();
+  EXPECT_EQ(element->requirement().min_x, 4);
+
+  Screen screen(4, 1);
+  Render(screen, element);
+  EXPECT_EQ(screen.at(3, 0), "d");
+
+  // A shrinking text, with a forgotten update, still renders safely.
+  t = "a";
+  Screen small(4, 1);
+  Render(small, element);
+  EXPECT_EQ(small.at(0, 0), "a");
+  EXPECT_EQ(small.at(1, 0), "");
+}
+
+TEST(TextTest, GlyphCache) {
+  // The glyphs come from the cache instead of being iterated again.
+  GlyphCache::SetCapacity(16);
+  GlyphCache::ResetStats();
+  std::string t = "a测b";
+  size_t generation = 0;
+  auto owned = text("a测b");
+  auto referenced = text(&t, &generation);
+  Screen screen(4, 2);
+  Render(screen, vbox({owned, referenced}));
+  EXPECT_EQ(screen.ToString(), "a测b\r\na测b");
+  EXPECT_EQ(GlyphCache::GetStats().hits, 1u);
+
+  // A shrinking text, with a forgotten update, still renders safely.
+  t = "a";
+  Screen small(4, 1);
+  Render(small, referenced);
+  EXPECT_EQ(small.at(0, 0), "a");
+  EXPECT_EQ(small.at(1, 0), "");
+  GlyphCache::SetCapacity(0);
+}
+
 }  // namespace ftxui
 // NOLINTEND
@@ -6,12 +6,13 @@
 #include <memory>      // for __shared_ptr_access, make_unique
 #include <utility>     // for move
 
-#include "ftxui/dom/elements.hpp"  // for Element, Decorator, Elements, operator|, Fit, emptyElement, nothing, operator|=
-#include "ftxui/dom/node.hpp"      // for Node, Node::Status
-#include "ftxui/dom/requirement.hpp"  // for Requirement
-#include "ftxui/screen/box.hpp"       // for Box
-#include "ftxui/screen/screen.hpp"    // for Full
-#include "ftxui/screen/terminal.hpp"  // for Dimensions
+#include "ftxui/dom/element_arena.hpp"  // for MakeElement
+#include "ftxui/dom/elements.hpp"       // for Element, Decorator, Elements, operator|, Fit, emptyElement, nothing, operator|=
+#include "ftxui/dom/node.hpp"           // for Node, Node::Status
+#include "ftxui/dom/requirement.hpp"    // for Requirement
+#include "ftxui/screen/box.hpp"         // for Box
+#include "ftxui/screen/screen.hpp"      // for Full
+#include "ftxui/screen/terminal.hpp"    // for Dimensions
 
 namespace ftxui {
 
@@ -102,7 +103,7 @@ Dimensions Dimension::Fit(Element& e, bool extend_beyond_screen) {
   e->Check(&status);
   const int max_iteration = 20;
   while (status.need_iteration && status.iteration < max_iteration) {
-    e->ComputeRequirement();
+    e->ComputeRequirementIfDirty();
 
     // Don't give the element more space than it needs:
     box.x_max = std::min(box.x_max, e->requirement().min_x);
@@ -111,7 +112,7 @@ Dimensions Dimension::Fit(Element& e, bool extend_beyond_screen) {
       box.y_max = std::min(box.y_max, fullsize.dimy);
     }
 
-    e->SetBox(box);
+    e->SetBoxIfDirty(box);
     status.need_iteration = false;
     status.iteration++;
     e->Check(&status);
@@ -139,12 +140,16 @@ Dimensions Dimension::Fit(Element& e, bool extend_beyond_screen) {
 /// @ingroup dom
 Element emptyElement() {
   class Impl : public Node {
+   public:
+    Impl() { cacheable_ = true; }
+
+   private:
     void ComputeRequirement() override {
       requirement_.min_x = 0;
       requirement_.min_y = 0;
     }
   };
-  return std::make_unique<Impl>();
+  return MakeElement<Impl>();
 }
 
 }  // namespace ftxui
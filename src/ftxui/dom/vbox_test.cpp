@@ -4,11 +4,13 @@
 #include <gtest/gtest.h>
 #include <algorithm>  // for remove
 #include <cstddef>    // for size_t
+#include <memory>     // for make_shared
 #include <string>     // for string, allocator, basic_string
 #include <vector>     // for vector
 
 #include "ftxui/dom/elements.hpp"  // for vtext, operator|, vbox, Element, flex_grow, flex_shrink
-#include "ftxui/dom/node.hpp"       // for Render
+#include "ftxui/dom/node.hpp"       // for Node, Render
+#include "ftxui/screen/box.hpp"     // for Box
 #include "ftxui/screen/screen.hpp"  // for Screen
 
 // NOLINTBEGIN
@@ -21,6 +23,79 @@ std::string rotate(std::string str) {
   return str;
 }
 
+// A line, counting how many times it is laid out and drawn.
+class CountingLine : public Node {
+ public:
+  CountingLine(int* set_box, int* render)
+      : set_box_(set_box), render_(render) {}
+
+  void ComputeRequirement() override {
+    requirement_.min_x = 1;
+    requirement_.min_y = 1;
+  }
+
+  void SetBox(Box box) override {
+    Node::SetBox(box);
+    ++*set_box_;
+  }
+
+  void Render(Screen& screen) override {
+    ++*render_;
+    screen.PixelAt(box_.x_min, box_.y_min).character = "x";
+  }
+
+ private:
+  int* set_box_;
+  int* render_;
+};
+
+// A line whose layout is cached, counting how many times it is computed.
+class CachedLine : public Node {
+ public:
+  CachedLine(int* compute, int* set_box)
+      : compute_(compute), set_box_(set_box) {
+    cacheable_ = true;
+  }
+
+  void ComputeRequirement() override {
+    ++*compute_;
+    requirement_.min_x = 1;
+    requirement_.min_y = 1;
+  }
+
+  void SetBox(Box box) override {
+    Node::SetBox(box);
+    ++*set_box_;
+  }
+
+  void Render(Screen& screen) override {
+    screen.PixelAt(box_.x_min, box_.y_min).character = "x";
+  }
+
+ private:
+  int* compute_;
+  int* set_box_;
+};
+
+// A cacheable line whose width can change.
+class ResizableLine : public Node {
+ public:
+  explicit ResizableLine(int width) : width_(width) { cacheable_ = true; }
+
+  void SetWidth(int width) {
+    width_ = width;
+    Invalidate();
+  }
+
+  void ComputeRequirement() override {
+    requirement_.min_x = width_;
+    requirement_.min_y = 1;
+  }
+
+ private:
+  int width_;
+};
+
 }  // namespace
 
 TEST(VBoxText, NoFlex_NoFlex_NoFlex) {
@@ -368,5 +443,122 @@ TEST(VBoxText, FlexGrow_NoFlex_FlewShrink) {
   }
 }
 
+TEST(VBoxTest, FrameSkipsHiddenChildren) {
+  int set_box = 0;
+  int render = 0;
+  Elements lines;
+  for (int i = 0; i < 10000; ++i) {
+    lines.push_back(std::make_shared<CountingLine>(&set_box, &render));
+  }
+  lines[5000] = lines[5000] | focus;
+  auto root = vbox({
+      text("title"),
+      vbox(std::move(lines)) | yframe | size(HEIGHT, EQUAL, 3),
+      text("footer"),
+  });
+
+  Screen screen(6, 5);
+  Render(screen, root);
+  EXPECT_EQ(set_box, 3);
+  EXPECT_EQ(render, 3);
+  EXPECT_EQ(rotate(screen.ToString()), "title x     x     x     footer");
+}
+
+TEST(VBoxTest, FrameHiddenReflect) {
+  Box visible_box;
+  Box hidden_box;
+  auto root = vbox({
+                  text("visible") | reflect(visible_box),
+                  text("hidden") | reflect(hidden_box),
+              }) |
+              yframe;
+
+  Screen screen(10, 1);
+  Render(screen, root);
+  EXPECT_EQ(visible_box, (Box{0, 9, 0, 0}));
+  EXPECT_TRUE(hidden_box.IsEmpty());
+}
+
+TEST(VBoxTest, CacheUnchangedLayout) {
+  int compute = 0;
+  int set_box = 0;
+  auto first = std::make_shared<CachedLine>(&compute, &set_box);
+  auto second = std::make_shared<CachedLine>(&compute, &set_box);
+  auto root = vbox({first, separator(), second}) | border;
+
+  Screen screen(4, 5);
+  Render(screen, root);
+  EXPECT_EQ(compute, 2);
+  EXPECT_EQ(set_box, 2);
+  EXPECT_EQ(rotate(screen.ToString()), "╭──╮│x │├──┤│x │╰──╯");
+
+  // Nothing changed.
+  Render(screen, root);
+  EXPECT_EQ(compute, 2);
+  EXPECT_EQ(set_box, 2);
+  EXPECT_EQ(rotate(screen.ToString()), "╭──╮│x │├──┤│x │╰──╯");
+
+  // A different box lays the lines out again, without measuring them.
+  Screen larger(5, 5);
+  Render(larger, root);
+  EXPECT_EQ(compute, 2);
+  EXPECT_EQ(set_box, 4);
+
+  // An invalidated line is measured again, and so are its ancestors. Its
+  // sibling keeps its box.
+  second->Invalidate();
+  Render(larger, root);
+  EXPECT_EQ(compute, 3);
+  EXPECT_EQ(set_box, 5);
+}
+
+TEST(VBoxTest, CacheNeedsCacheableChildren) {
+  int compute = 0;
+  int set_box = 0;
+  int counting_set_box = 0;
+  int render = 0;
+  auto cached = std::make_shared<CachedLine>(&compute, &set_box);
+  auto root = vbox({
+      cached,
+      std::make_shared<CountingLine>(&counting_set_box, &render),
+  });
+
+  Screen screen(1, 2);
+  Render(screen, root);
+  Render(screen, root);
+
+  // The vbox depends on an element it can't cache. Only its cacheable child
+  // keeps its layout.
+  EXPECT_EQ(compute, 1);
+  EXPECT_EQ(set_box, 1);
+  EXPECT_EQ(counting_set_box, 2);
+}
+
+TEST(VBoxTest, CacheSharedChild) {
+  auto line = std::make_shared<ResizableLine>(1);
+  auto first = vbox({line});
+  auto second = vbox({line, line});
+
+  Screen screen(5, 2);
+  Render(screen, first);
+  Render(screen, second);
+  EXPECT_EQ(first->requirement().min_x, 1);
+  EXPECT_EQ(second->requirement().min_x, 1);
+
+  // Every parent of the shared line sees its new width, not only the last one
+  // it was added to.
+  line->SetWidth(3);
+  Render(screen, first);
+  Render(screen, second);
+  EXPECT_EQ(first->requirement().min_x, 3);
+  EXPECT_EQ(second->requirement().min_x, 3);
+
+  line->SetWidth(2);
+  Render(screen, second);
+  Render(screen, first);
+  EXPECT_EQ(first->requirement().min_x, 2);
+  EXPECT_EQ(second->requirement().min_x, 2);
+}
+
 }  // namespace ftxui
 // NOLINTEND
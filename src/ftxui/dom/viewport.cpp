@@ -0,0 +1,20 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/dom/viewport.hpp"
+
+#include <limits>  // for numeric_limits
+
+#include "ftxui/screen/box.hpp"  // for Box
+
+namespace ftxui::viewport {
+
+Box& Visible() {
+  // Everything is visible, unless an element is laid out by Render().
+  constexpr int kMin = std::numeric_limits<int>::min();
+  constexpr int kMax = std::numeric_limits<int>::max();
+  thread_local Box visible = {kMin, kMax, kMin, kMax};
+  return visible;
+}
+
+}  // namespace ftxui::viewport
@@ -0,0 +1,49 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#ifndef FTXUI_DOM_VIEWPORT_HPP
+#define FTXUI_DOM_VIEWPORT_HPP
+
+#include <cstddef>  // for size_t
+#include <limits>   // for numeric_limits
+
+#include "ftxui/dom/node.hpp"    // for Elements
+#include "ftxui/screen/box.hpp"  // for Box
+
+namespace ftxui::viewport {
+
+// The part of the screen visible while the elements are laid out. Frame narrows
+// it to its own box, and containers skip the layout of the children outside of
+// it.
+Box& Visible();
+
+// The children of a container which were laid out: the visible ones, and the
+// focused one wherever it is, since the cursor is placed on it.
+struct LaidOut {
+  static constexpr size_t kNone = std::numeric_limits<size_t>::max();
+
+  size_t begin = 0;
+  size_t end = 0;
+  size_t focused = kNone;
+
+  void Add(size_t index) {
+    if (begin == end) {
+      begin = index;
+    }
+    end = index + 1;
+  }
+
+  template <typename Function>
+  void ForEach(const Elements& children, Function function) const {
+    for (size_t i = begin; i < end && i < children.size(); ++i) {
+      function(children[i]);
+    }
+    if (focused < children.size() && (focused < begin || focused >= end)) {
+      function(children[focused]);
+    }
+  }
+};
+
+}  // namespace ftxui::viewport
+
+#endif  // FTXUI_DOM_VIEWPORT_HPP
@@ -0,0 +1,126 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <algorithm>   // for max, min
+#include <cstdint>     // for int64_t
+#include <functional>  // for function
+#include <limits>      // for numeric_limits
+#include <memory>      // for make_shared
+#include <utility>     // for move
+
+#include "ftxui/dom/element_arena.hpp"  // for MakeElement
+#include "ftxui/dom/elements.hpp"       // for Element, virtualList
+#include "ftxui/dom/node.hpp"           // for Node, Elements
+#include "ftxui/dom/requirement.hpp"    // for Requirement
+#include "ftxui/dom/viewport.hpp"       // for Visible
+#include "ftxui/screen/box.hpp"         // for Box
+
+namespace ftxui {
+
+namespace {
+
+class VirtualList : public Node {
+ public:
+  VirtualList(int count,
+              int row_height,
+              std::function<Element(int)> generator)
+      : count_(std::max(count, 0)),
+        row_height_(std::max(row_height, 1)),
+        generator_(std::move(generator)) {}
+
+ private:
+  void ComputeRequirement() override {
+    requirement_ = Requirement{};
+    const int64_t height = int64_t(count_) * row_height_;
+    requirement_.min_y =
+        int(std::min<int64_t>(height, std::numeric_limits<int>::max()));
+
+    // The width of the rows is only known once they are built. Use the widest
+    // row built so far.
+    for (auto& child : children_) {
+      child->ComputeRequirementIfDirty();
+      min_x_ = std::max(min_x_, child->requirement().min_x);
+    }
+    requirement_.min_x = min_x_;
+  }
+
+  void SetBox(Box box) override {
+    Node::SetBox(box);
+
+    // The rows overlapping the visible part of the list. They are built even
+    // when the list has no width yet, to know how wide they are.
+    const int y_min = std::max(box.y_min, viewport::Visible().y_min);
+    const int y_max = std::min(box.y_max, viewport::Visible().y_max);
+    int first = 0;
+    int last = 0;
+    if (y_min <= y_max) {
+      first = int((int64_t(y_min) - box.y_min) / row_height_);
+      last = int((int64_t(y_max) - box.y_min) / row_height_) + 1;
+      first = std::max(0, std::min(first, count_));
+      last = std::max(first, std::min(last, count_));
+    }
+
+    // Build the rows only when they change, so that the rows needing several
+    // layout iterations can converge.
+    if (first != first_ || last - first != int(children_.size())) {
+      first_ = first;
+      children_.clear();
+      for (int i = first; i < last; ++i) {
+        Element row = generator_(i);
+        row->ComputeRequirementIfDirty();
+        min_x_ = std::max(min_x_, row->requirement().min_x);
+        children_.push_back(std::move(row));
+      }
+    }
+
+    for (size_t i = 0; i < children_.size(); ++i) {
+      const int64_t y = box.y_min + (first_ + int64_t(i)) * row_height_;
+      Box row_box = box;
+      row_box.y_min = int(y);
+      row_box.y_max = int(y + row_height_ - 1);
+      children_[i]->SetBoxIfDirty(row_box);
+    }
+  }
+
+  void Check(Status* status) override {
+    Node::Check(status);
+
+    // Lay out again once the list is as wide as its rows.
+    status->need_iteration |= (requirement_.min_x != min_x_);
+  }
+
+  const int count_;
+  const int row_height_;
+  const std::function<Element(int)> generator_;
+  int first_ = -1;
+  int min_x_ = 0;
+};
+
+}  // namespace
+
+/// @brief A list of rows too long to be built, like the lines of a log file.
+/// Only the rows visible on the screen are built, by calling the |generator|.
+/// The list requests the height of all its rows.
+///
+/// Use it inside a `frame` or a `yframe`. Scroll it with `focusPosition`.
+///
+/// @param count The number of rows.
+/// @param row_height The height of every row.
+/// @param generator Build the row at a given index.
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// Element document =
+///     virtualList(lines.size(), 1,
+///                 [&](int i) { return text(lines[i]); }) |
+///     focusPosition(0, selected) | vscroll_indicator | yframe;
+/// ```
+Element virtualList(int count,
+                    int row_height,
+                    std::function<Element(int)> generator) {
+  return MakeElement<VirtualList>(count, row_height, std::move(generator));
+}
+
+}  // namespace ftxui
@@ -0,0 +1,74 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <gtest/gtest.h>
+#include <string>  // for string, to_string
+#include <vector>  // for vector
+
+#include "ftxui/dom/elements.hpp"  // for virtualList, text, focusPosition, yframe, vscroll_indicator
+#include "ftxui/dom/node.hpp"       // for Render
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+TEST(VirtualListTest, BuildsTheVisibleRows) {
+  std::vector<int> built;
+  auto list = virtualList(10000000, 1, [&](int i) {
+    built.push_back(i);
+    return text(std::to_string(i));
+  });
+
+  Screen screen(8, 3);
+  Render(screen, list | focusPosition(0, 5000000) | yframe);
+  EXPECT_EQ(built, (std::vector<int>{4999999, 5000000, 5000001}));
+  EXPECT_EQ(screen.ToString(),
+            "4999999 \r\n"
+            "5000000 \r\n"
+            "5000001 ");
+}
+
+TEST(VirtualListTest, RowHeight) {
+  auto list = virtualList(100, 2, [&](int i) {
+    return vbox({text(std::to_string(i)), text("-")});
+  });
+
+  Screen screen(3, 4);
+  Render(screen, list | focusPosition(0, 21) | yframe);
+  EXPECT_EQ(screen.ToString(),
+            "10 \r\n"
+            "-  \r\n"
+            "11 \r\n"
+            "-  ");
+}
+
+TEST(VirtualListTest, Width) {
+  auto list = virtualList(3, 1, [&](int i) {
+    return text(std::string(size_t(i) + 1, 'x'));
+  });
+  auto document = hbox({list, text("|")});
+
+  Screen screen(5, 3);
+  Render(screen, document);
+  EXPECT_EQ(screen.ToString(),
+            "x  | \r\n"
+            "xx   \r\n"
+            "xxx  ");
+}
+
+TEST(VirtualListTest, ScrollIndicator) {
+  auto list = virtualList(100, 1, [&](int i) {
+    return text(std::to_string(i));
+  });
+
+  Screen screen(3, 4);
+  Render(screen, list | focusPosition(0, 99) | vscroll_indicator | yframe);
+  EXPECT_EQ(screen.ToString(),
+            "96 \r\n"
+            "97 \r\n"
+            "98 \r\n"
+            "99╻");
+}
+
+}  // namespace ftxui
+// NOLINTEND
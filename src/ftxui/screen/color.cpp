@@ -3,7 +3,8 @@
 // the LICENSE file.
 #include "ftxui/screen/color.hpp"
 
-#include <array>  // for array
+#include <algorithm>  // for clamp
+#include <array>      // for array
 #include <cmath>
 #include <cstdint>
 #include <string>
@@ -32,45 +33,141 @@ const std::array<const char*, 33> palette16code = {
     "97", "107",  //
 };
 
-}  // namespace
+// The decimal representation of every byte, to print color components without
+// formatting them.
+struct DecimalByte {
+  char digits[3];  // NOLINT
+  uint8_t size;
+};
 
-bool Color::operator==(const Color& rhs) const {
-  return red_ == rhs.red_ && green_ == rhs.green_ && blue_ == rhs.blue_ &&
-         type_ == rhs.type_;
+constexpr std::array<DecimalByte, 256> BuildDecimalBytes() {
+  std::array<DecimalByte, 256> table = {};
+  for (int i = 0; i < 256; ++i) {  // NOLINT
+    DecimalByte& entry = table[i];
+    if (i >= 100) {                                      // NOLINT
+      entry.digits[entry.size++] = char('0' + i / 100);  // NOLINT
+    }
+    if (i >= 10) {                                            // NOLINT
+      entry.digits[entry.size++] = char('0' + i / 10 % 10);  // NOLINT
+    }
+    entry.digits[entry.size++] = char('0' + i % 10);  // NOLINT
+  }
+  return table;
 }
 
-bool Color::operator!=(const Color& rhs) const {
-  return !operator==(rhs);
+constexpr std::array<DecimalByte, 256> decimal_bytes = BuildDecimalBytes();
+
+void AppendByte(std::string& out, uint8_t value) {
+  const DecimalByte& entry = decimal_bytes[value];
+  out.append(entry.digits, entry.size);  // NOLINT
 }
 
-std::string Color::Print(bool is_background_color) const {
-  if (is_background_color) {
-    switch (type_) {
-      case ColorType::Palette1:
-        return "49";
-      case ColorType::Palette16:
-        return palette16code[2 * red_ + 1];  // NOLINT
-      case ColorType::Palette256:
-        return "48;5;" + std::to_string(red_);
-      case ColorType::TrueColor:
-        return "48;2;" + std::to_string(red_) + ";" + std::to_string(green_) +
-               ";" + std::to_string(blue_);
+// Past the 16 first colors, the 256 colors palette is made of a 6x6x6 color
+// cube, followed by 24 shades of gray. See color_info.cpp.
+constexpr int palette256_cube_begin = 16;
+constexpr int palette256_gray_begin = 232;
+constexpr int palette256_gray_count = 24;
+constexpr std::array<int, 6> cube_levels = {0, 95, 135, 175, 215, 255};
+
+constexpr int GrayLevel(int index) {
+  return 8 + 10 * index;  // NOLINT
+}
+
+// The index of the closest cube level, for every channel value. Ties are
+// resolved toward the lowest level.
+constexpr std::array<uint8_t, 256> BuildClosestCubeLevel() {
+  std::array<uint8_t, 256> table = {};
+  for (int value = 0; value < 256; ++value) {  // NOLINT
+    int best = 0;
+    for (int i = 1; i < int(cube_levels.size()); ++i) {
+      const int distance = value - cube_levels[i];
+      const int best_distance = value - cube_levels[best];
+      if (distance * distance < best_distance * best_distance) {
+        best = i;
+      }
     }
-  } else {
-    switch (type_) {
-      case ColorType::Palette1:
-        return "39";
-      case ColorType::Palette16:
-        return palette16code[2 * red_];  // NOLINT
-      case ColorType::Palette256:
-        return "38;5;" + std::to_string(red_);
-      case ColorType::TrueColor:
-        return "38;2;" + std::to_string(red_) + ";" + std::to_string(green_) +
-               ";" + std::to_string(blue_);
+    table[value] = uint8_t(best);
+  }
+  return table;
+}
+
+constexpr std::array<uint8_t, 256> closest_cube_level = BuildClosestCubeLevel();
+
+int Square(int value) {
+  return value * value;
+}
+
+// Return the Palette256 color closest to |red|, |green|, |blue|, excluding the
+// 16 first ones. This gives the same result as comparing the distance to every
+// color, keeping the first closest one, but runs in constant time:
+// - In the cube, the closest color is made of the closest level of each
+//   channel.
+// - In the grays, the distance is minimal for the level closest to the mean of
+//   the channels.
+int ClosestPalette256(uint8_t red, uint8_t green, uint8_t blue) {
+  const int r = closest_cube_level[red];
+  const int g = closest_cube_level[green];
+  const int b = closest_cube_level[blue];
+  const int cube_distance = Square(red - cube_levels[r]) +    // NOLINT
+                            Square(green - cube_levels[g]) +  // NOLINT
+                            Square(blue - cube_levels[b]);    // NOLINT
+
+  const int sum = red + green + blue;
+  const int below = std::clamp((sum - 3 * GrayLevel(0)) / 30, 0,  // NOLINT
+                               palette256_gray_count - 1);
+  int gray = below;
+  int gray_distance = Square(red - GrayLevel(below)) +    //
+                      Square(green - GrayLevel(below)) +  //
+                      Square(blue - GrayLevel(below));
+  if (below + 1 < palette256_gray_count) {
+    const int above = below + 1;
+    const int distance = Square(red - GrayLevel(above)) +    //
+                         Square(green - GrayLevel(above)) +  //
+                         Square(blue - GrayLevel(above));
+    if (distance < gray_distance) {
+      gray = above;
+      gray_distance = distance;
     }
   }
+
+  if (gray_distance < cube_distance) {
+    return palette256_gray_begin + gray;
+  }
+  return palette256_cube_begin + 36 * r + 6 * g + b;  // NOLINT
+}
+
+}  // namespace
+
+std::string Color::Print(bool is_background_color) const {
+  std::string out;
+  Print(is_background_color, out);
+  return out;
+}
+
+/// @brief Append the SGR parameters selecting this color to |out|, without
+/// any temporary allocation.
+void Color::Print(bool is_background_color, std::string& out) const {
+  switch (type_) {
+    case ColorType::Palette1:
+      out += is_background_color ? "49" : "39";
+      return;
+    case ColorType::Palette16:
+      out += palette16code[2 * red_ + int(is_background_color)];  // NOLINT
+      return;
+    case ColorType::Palette256:
+      out += is_background_color ? "48;5;" : "38;5;";
+      AppendByte(out, red_);
+      return;
+    case ColorType::TrueColor:
+      out += is_background_color ? "48;2;" : "38;2;";
+      AppendByte(out, red_);
+      out += ';';
+      AppendByte(out, green_);
+      out += ';';
+      AppendByte(out, blue_);
+      return;
+  }
   // NOTREACHED();
-  return "";
 }
 
 /// @brief Build a transparent color.
@@ -111,22 +208,7 @@ Color::Color(uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha)
   }
 
   // Find the closest Color from the database:
-  const int max_distance = 256 * 256 * 3;
-  int closest = max_distance;
-  int best = 0;
-  const int database_begin = 16;
-  const int database_end = 256;
-  for (int i = database_begin; i < database_end; ++i) {
-    const ColorInfo color_info = GetColorInfo(Color::Palette256(i));
-    const int dr = color_info.red - red;
-    const int dg = color_info.green - green;
-    const int db = color_info.blue - blue;
-    const int dist = dr * dr + dg * dg + db * db;
-    if (closest > dist) {
-      closest = dist;
-      best = i;
-    }
-  }
+  const int best = ClosestPalette256(red, green, blue);
 
   if (Terminal::ColorSupport() == Terminal::Color::Palette256) {
     type_ = ColorType::Palette256;
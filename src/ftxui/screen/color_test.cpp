@@ -3,6 +3,8 @@
 // the LICENSE file.
 #include "ftxui/screen/color.hpp"
 #include <gtest/gtest.h>
+#include <string>                       // for to_string
+#include "ftxui/screen/color_info.hpp"  // for ColorInfo, GetColorInfo
 #include "ftxui/screen/terminal.hpp"
 
 namespace ftxui {
@@ -36,6 +38,32 @@ TEST(ColorTest, FallbackTo256) {
   EXPECT_EQ(Color::RGB(1, 2, 3).Print(false), "38;5;16");
 }
 
+TEST(ColorTest, FallbackTo256Closest) {
+  Terminal::SetColorSupport(Terminal::Color::Palette256);
+  // Compare with an exhaustive search of the closest color.
+  for (int r = 0; r < 256; r += 5) {
+    for (int g = 0; g < 256; g += 5) {
+      for (int b = 0; b < 256; b += 5) {
+        int closest = 256 * 256 * 3;
+        int best = 0;
+        for (int i = 16; i < 256; ++i) {
+          const ColorInfo info = GetColorInfo(Color::Palette256(i));
+          const int dr = info.red - r;
+          const int dg = info.green - g;
+          const int db = info.blue - b;
+          const int distance = dr * dr + dg * dg + db * db;
+          if (closest > distance) {
+            closest = distance;
+            best = i;
+          }
+        }
+        EXPECT_EQ(Color::RGB(r, g, b).Print(false),
+                  "38;5;" + std::to_string(best));
+      }
+    }
+  }
+}
+
 TEST(ColorTest, FallbackTo16) {
   Terminal::SetColorSupport(Terminal::Color::Palette16);
   EXPECT_EQ(Color::RGB(1, 2, 3).Print(false), "30");
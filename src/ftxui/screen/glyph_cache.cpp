@@ -0,0 +1,150 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/screen/glyph_cache.hpp"
+
+#include <atomic>         // for atomic, memory_order_relaxed
+#include <cstddef>        // for size_t
+#include <functional>     // for hash
+#include <list>           // for list
+#include <memory>         // for make_shared, shared_ptr
+#include <mutex>          // for mutex, lock_guard
+#include <string>         // for string
+#include <string_view>    // for string_view
+#include <unordered_map>  // for unordered_map
+#include <utility>        // for move
+
+#include "ftxui/screen/string.hpp"  // for Glyphs
+
+namespace ftxui::GlyphCache {
+
+namespace {
+
+// Longer strings are rarely repeated, and would use most of the memory.
+constexpr size_t kMaxCachedLength = 256;
+
+struct Entry {
+  std::string text;
+  size_t hash;
+  std::shared_ptr<const GlyphLayout> layout;
+};
+
+// The most recently used entries are at the front of |entries|. |index| maps
+// the hash of a text to its entry. |capacity| is read without the lock, so
+// that a disabled cache costs nothing.
+struct Cache {
+  std::mutex mutex;
+  std::list<Entry> entries;
+  std::unordered_map<size_t, std::list<Entry>::iterator> index;
+  std::atomic<size_t> capacity = 0;
+  size_t hits = 0;
+  size_t misses = 0;
+};
+
+Cache& GetCache() {
+  static Cache cache;
+  return cache;
+}
+
+std::shared_ptr<const GlyphLayout> Measure(std::string_view text) {
+  auto layout = std::make_shared<GlyphLayout>();
+  const GlyphRange glyphs = Glyphs(text);
+  for (auto it = glyphs.begin(); it != glyphs.end(); ++it) {
+    layout->glyphs.push_back({static_cast<uint32_t>(it.position()),
+                              static_cast<uint32_t>(it->value.size()),
+                              it->width});
+    layout->width += it->width;
+  }
+  return layout;
+}
+
+}  // namespace
+
+/// @brief Whether the cache is enabled, i.e. its capacity isn't 0.
+/// @ingroup screen
+bool Enabled() {
+  return GetCache().capacity.load(std::memory_order_relaxed) != 0;
+}
+
+/// @brief Return the glyphs of |text|, from the cache when possible. The
+/// lookups of texts that can't be cached, because the cache is disabled or the
+/// text is too long, aren't counted in the stats.
+/// @ingroup screen
+std::shared_ptr<const GlyphLayout> Get(std::string_view text) {
+  Cache& cache = GetCache();
+  if (cache.capacity.load(std::memory_order_relaxed) == 0 ||
+      text.size() > kMaxCachedLength) {
+    return Measure(text);
+  }
+
+  const size_t hash = std::hash<std::string_view>()(text);
+  {
+    const std::lock_guard<std::mutex> lock(cache.mutex);
+    auto it = cache.index.find(hash);
+    if (it != cache.index.end() && it->second->text == text) {
+      cache.entries.splice(cache.entries.begin(), cache.entries, it->second);
+      cache.hits++;
+      return it->second->layout;
+    }
+    cache.misses++;
+  }
+
+  // Measure outside of the lock. Another thread may insert the same text in
+  // the meantime, the last one wins.
+  std::shared_ptr<const GlyphLayout> layout = Measure(text);
+
+  const std::lock_guard<std::mutex> lock(cache.mutex);
+  const size_t capacity = cache.capacity.load(std::memory_order_relaxed);
+  if (capacity == 0) {
+    return layout;
+  }
+  auto it = cache.index.find(hash);
+  if (it != cache.index.end()) {
+    cache.entries.erase(it->second);
+    cache.index.erase(it);
+  }
+  while (cache.entries.size() >= capacity) {
+    cache.index.erase(cache.entries.back().hash);
+    cache.entries.pop_back();
+  }
+  cache.entries.push_front({std::string(text), hash, layout});
+  cache.index[hash] = cache.entries.begin();
+  return layout;
+}
+
+/// @brief Set the maximum number of strings in the cache. 0 disables it, and
+/// is the default.
+/// @ingroup screen
+void SetCapacity(size_t capacity) {
+  Cache& cache = GetCache();
+  const std::lock_guard<std::mutex> lock(cache.mutex);
+  cache.capacity.store(capacity, std::memory_order_relaxed);
+  while (cache.entries.size() > capacity) {
+    cache.index.erase(cache.entries.back().hash);
+    cache.entries.pop_back();
+  }
+}
+
+/// @brief Return the usage of the cache.
+/// @ingroup screen
+Stats GetStats() {
+  Cache& cache = GetCache();
+  const std::lock_guard<std::mutex> lock(cache.mutex);
+  Stats stats;
+  stats.hits = cache.hits;
+  stats.misses = cache.misses;
+  stats.size = cache.entries.size();
+  stats.capacity = cache.capacity.load(std::memory_order_relaxed);
+  return stats;
+}
+
+/// @brief Reset the hit and miss counters.
+/// @ingroup screen
+void ResetStats() {
+  Cache& cache = GetCache();
+  const std::lock_guard<std::mutex> lock(cache.mutex);
+  cache.hits = 0;
+  cache.misses = 0;
+}
+
+}  // namespace ftxui::GlyphCache
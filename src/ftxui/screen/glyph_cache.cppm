@@ -0,0 +1,25 @@
+/// @module ftxui.screen.glyph_cache
+/// @brief Module file for the GlyphCache namespace of the Screen module
+
+module;
+
+#include <ftxui/screen/glyph_cache.hpp>
+
+export module ftxui.screen.glyph_cache;
+
+/**
+ * @namespace ftxui
+ * @brief The FTXUI ftxui:: namespace
+ */
+export namespace ftxui {
+    using ftxui::GlyphLayout;
+
+    namespace GlyphCache {
+        using ftxui::GlyphCache::Stats;
+        using ftxui::GlyphCache::Get;
+        using ftxui::GlyphCache::Enabled;
+        using ftxui::GlyphCache::SetCapacity;
+        using ftxui::GlyphCache::GetStats;
+        using ftxui::GlyphCache::ResetStats;
+    }
+}
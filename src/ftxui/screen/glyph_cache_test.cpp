@@ -0,0 +1,81 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/screen/glyph_cache.hpp"
+
+#include <gtest/gtest.h>
+#include <string>  // for string
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+
+// Enable the cache for the duration of a test.
+class GlyphCacheTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    GlyphCache::SetCapacity(2);
+    GlyphCache::ResetStats();
+  }
+  void TearDown() override { GlyphCache::SetCapacity(0); }
+};
+
+}  // namespace
+
+TEST_F(GlyphCacheTest, Layout) {
+  auto layout = GlyphCache::Get("a测e\xCC\x81");  // With a combining accent.
+  EXPECT_EQ(layout->width, 4);
+  ASSERT_EQ(layout->glyphs.size(), 3u);
+  EXPECT_EQ(layout->glyphs[1].offset, 1u);
+  EXPECT_EQ(layout->glyphs[1].size, 3u);
+  EXPECT_EQ(layout->glyphs[1].width, 2);
+  EXPECT_EQ(layout->glyphs[2].offset, 4u);
+  EXPECT_EQ(layout->glyphs[2].size, 3u);
+  EXPECT_EQ(layout->glyphs[2].width, 1);
+}
+
+TEST_F(GlyphCacheTest, HitAndMiss) {
+  auto a = GlyphCache::Get("a");
+  EXPECT_EQ(GlyphCache::Get(std::string("a")), a);
+  GlyphCache::Get("b");
+
+  GlyphCache::Stats stats = GlyphCache::GetStats();
+  EXPECT_EQ(stats.hits, 1u);
+  EXPECT_EQ(stats.misses, 2u);
+  EXPECT_EQ(stats.size, 2u);
+  EXPECT_EQ(stats.capacity, 2u);
+}
+
+TEST_F(GlyphCacheTest, LeastRecentlyUsed) {
+  auto a = GlyphCache::Get("a");
+  auto b = GlyphCache::Get("b");
+  GlyphCache::Get("a");
+  GlyphCache::Get("c");  // Evicts "b".
+
+  EXPECT_EQ(GlyphCache::Get("a"), a);
+  EXPECT_NE(GlyphCache::Get("b"), b);
+  EXPECT_EQ(GlyphCache::GetStats().size, 2u);
+}
+
+TEST_F(GlyphCacheTest, Disabled) {
+  EXPECT_TRUE(GlyphCache::Enabled());
+  GlyphCache::SetCapacity(0);
+  EXPECT_FALSE(GlyphCache::Enabled());
+  auto a = GlyphCache::Get("a");
+  EXPECT_NE(GlyphCache::Get("a"), a);
+  EXPECT_EQ(GlyphCache::Get("a")->width, 1);
+  EXPECT_EQ(GlyphCache::GetStats().size, 0u);
+  EXPECT_EQ(GlyphCache::GetStats().hits, 0u);
+  EXPECT_EQ(GlyphCache::GetStats().misses, 0u);
+}
+
+TEST_F(GlyphCacheTest, LongText) {
+  const std::string text(1000, 'a');
+  auto a = GlyphCache::Get(text);
+  EXPECT_EQ(a->width, 1000);
+  EXPECT_NE(GlyphCache::Get(text), a);
+}
+
+}  // namespace ftxui
+// NOLINTEND
@@ -0,0 +1,136 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/screen/glyph_index.hpp"
+
+#include <algorithm>    // for lower_bound, min
+#include <cstddef>      // for size_t, ptrdiff_t
+#include <string_view>  // for string_view
+#include <vector>       // for vector
+
+#include "ftxui/screen/string.hpp"  // for GlyphIterator, Glyphs
+
+namespace ftxui {
+
+namespace {
+
+// The longest UTF8 encoded codepoint.
+constexpr size_t kMaxCodepointSize = 4;
+
+}  // namespace
+
+GlyphIndex::GlyphIndex(std::string_view text) {
+  Reset(text);
+}
+
+/// @brief Index |text|, from scratch.
+void GlyphIndex::Reset(std::string_view text) {
+  bytes_.clear();
+  cells_.clear();
+  int cell = 0;
+  const GlyphRange glyphs = Glyphs(text);
+  for (auto it = glyphs.begin(); it != glyphs.end(); ++it) {
+    bytes_.push_back(it.position());
+    cells_.push_back(cell);
+    cell += it->width;
+  }
+  bytes_.push_back(text.size());
+  cells_.push_back(cell);
+}
+
+/// @brief Update the index after |removed| bytes at |position| were replaced
+/// by |inserted| bytes.
+/// @param text The text, after the edit.
+void GlyphIndex::Update(std::string_view text,
+                        size_t position,
+                        size_t removed,
+                        size_t inserted) {
+  // The glyphs starting before |position| still start at the same place, as
+  // long as their first codepoint is unchanged. The last ones may be extended
+  // or split by the edit. Segment again from before them.
+  size_t first = ByteToGlyph(position);
+  while (first > 0) {
+    --first;
+    if (bytes_[first] + kMaxCodepointSize <= position) {
+      break;
+    }
+  }
+  const size_t from = first == 0 ? 0 : bytes_[first];
+
+  // A glyph boundary doesn't depend on the text before it. Once a glyph after
+  // the edit starts where an old one did, the next ones are unchanged.
+  std::vector<size_t> bytes;
+  std::vector<int> cells;
+  size_t resume = size();
+  int cell = cells_[first];
+  const GlyphRange glyphs = Glyphs(text);
+  for (auto it = GlyphIterator(text, from); it != glyphs.end(); ++it) {
+    const size_t start = it.position();
+    if (start >= position + inserted) {
+      const size_t old_start = start - inserted + removed;
+      const size_t old = ByteToGlyph(old_start);
+      if (old < size() && bytes_[old] == old_start) {
+        resume = old;
+        break;
+      }
+    }
+    bytes.push_back(start);
+    cells.push_back(cell);
+    cell += it->width;
+  }
+
+  // Shift the unchanged glyphs, and the end of the text.
+  const auto byte_delta =
+      static_cast<std::ptrdiff_t>(inserted) - static_cast<std::ptrdiff_t>(removed);
+  const int cell_delta = cell - cells_[resume];
+  for (size_t i = resume; i < bytes_.size(); ++i) {
+    bytes_[i] = static_cast<size_t>(static_cast<std::ptrdiff_t>(bytes_[i]) +
+                                    byte_delta);
+    cells_[i] += cell_delta;
+  }
+
+  const auto begin = static_cast<std::ptrdiff_t>(first);
+  const auto end = static_cast<std::ptrdiff_t>(resume);
+  bytes_.erase(bytes_.begin() + begin, bytes_.begin() + end);
+  bytes_.insert(bytes_.begin() + begin, bytes.begin(), bytes.end());
+  cells_.erase(cells_.begin() + begin, cells_.begin() + end);
+  cells_.insert(cells_.begin() + begin, cells.begin(), cells.end());
+}
+
+size_t GlyphIndex::GlyphToByte(size_t glyph) const {
+  return bytes_[std::min(glyph, size())];
+}
+
+int GlyphIndex::GlyphToCell(size_t glyph) const {
+  return cells_[std::min(glyph, size())];
+}
+
+int GlyphIndex::GlyphWidth(size_t glyph) const {
+  if (glyph >= size()) {
+    return 0;
+  }
+  return cells_[glyph + 1] - cells_[glyph];
+}
+
+size_t GlyphIndex::ByteToGlyph(size_t byte) const {
+  return static_cast<size_t>(
+      std::lower_bound(bytes_.begin(), bytes_.end() - 1, byte) -
+      bytes_.begin());
+}
+
+size_t GlyphIndex::CellToGlyph(int cell) const {
+  return static_cast<size_t>(
+      std::lower_bound(cells_.begin(), cells_.end() - 1, cell) -
+      cells_.begin());
+}
+
+size_t GlyphIndex::Next(size_t byte) const {
+  return GlyphToByte(ByteToGlyph(byte) + 1);
+}
+
+size_t GlyphIndex::Previous(size_t byte) const {
+  const size_t glyph = ByteToGlyph(byte);
+  return glyph == 0 ? 0 : bytes_[glyph - 1];
+}
+
+}  // namespace ftxui
@@ -0,0 +1,16 @@
+/// @module ftxui.screen.glyph_index
+/// @brief Module file for the GlyphIndex class of the Screen module
+
+module;
+
+#include <ftxui/screen/glyph_index.hpp>
+
+export module ftxui.screen.glyph_index;
+
+/**
+ * @namespace ftxui
+ * @brief The FTXUI ftxui:: namespace
+ */
+export namespace ftxui {
+    using ftxui::GlyphIndex;
+}
@@ -0,0 +1,82 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/screen/glyph_index.hpp"
+
+#include <gtest/gtest.h>
+#include <random>  // for mt19937
+#include <string>  // for string
+
+#include "ftxui/screen/string_internal.hpp"  // for GlyphNext, GlyphPrevious
+
+// NOLINTBEGIN
+namespace ftxui {
+
+TEST(GlyphIndexTest, Empty) {
+  GlyphIndex index("");
+  EXPECT_EQ(index.size(), 0u);
+  EXPECT_EQ(index.width(), 0);
+  EXPECT_EQ(index.Next(0), 0u);
+  EXPECT_EQ(index.Previous(0), 0u);
+}
+
+TEST(GlyphIndexTest, Conversions) {
+  // Glyphs: a, 测, e + accent, b. The control character isn't one.
+  const std::string text = "a测é\1b";
+  GlyphIndex index(text);
+  EXPECT_EQ(index.size(), 4u);
+  EXPECT_EQ(index.width(), 5);
+
+  EXPECT_EQ(index.GlyphToByte(1), 1u);
+  EXPECT_EQ(index.GlyphToByte(3), 8u);
+  EXPECT_EQ(index.GlyphToByte(4), text.size());
+  EXPECT_EQ(index.GlyphToCell(2), 3);
+  EXPECT_EQ(index.GlyphWidth(1), 2);
+  EXPECT_EQ(index.GlyphWidth(2), 1);
+
+  EXPECT_EQ(index.ByteToGlyph(4), 2u);
+  EXPECT_EQ(index.ByteToGlyph(5), 3u);  // Inside a glyph.
+  EXPECT_EQ(index.ByteToGlyph(7), 3u);  // The control character.
+  EXPECT_EQ(index.CellToGlyph(1), 1u);
+  EXPECT_EQ(index.CellToGlyph(2), 2u);  // The second cell of 测.
+  EXPECT_EQ(index.CellToGlyph(5), 4u);
+
+  for (size_t i = 0; i <= text.size(); ++i) {
+    EXPECT_EQ(index.Next(i), GlyphNext(text, i));
+    EXPECT_EQ(index.Previous(i), GlyphPrevious(text, i));
+  }
+}
+
+TEST(GlyphIndexTest, Update) {
+  // Edits can extend or split the glyphs around them.
+  const char* pieces[] = {"a",  " ",  "\n",    "\1",    "测",
+                          "́", "‍", "\U0001F468", "\U0001F1EB"};
+  std::mt19937 random(42);
+  std::string text;
+  GlyphIndex index;
+  for (int i = 0; i < 2000; ++i) {
+    const size_t position = random() % (text.size() + 1);
+    size_t removed = 0;
+    std::string inserted;
+    if (random() % 3 == 0) {
+      removed = std::min<size_t>(random() % 8, text.size() - position);
+    } else {
+      for (int j = random() % 3; j >= 0; --j) {
+        inserted += pieces[random() % std::size(pieces)];
+      }
+    }
+
+    text.replace(position, removed, inserted);
+    index.Update(text, position, removed, inserted.size());
+
+    const GlyphIndex expected(text);
+    ASSERT_EQ(index.size(), expected.size()) << i;
+    for (size_t glyph = 0; glyph <= index.size(); ++glyph) {
+      ASSERT_EQ(index.GlyphToByte(glyph), expected.GlyphToByte(glyph)) << i;
+      ASSERT_EQ(index.GlyphToCell(glyph), expected.GlyphToCell(glyph)) << i;
+    }
+  }
+}
+
+}  // namespace ftxui
+// NOLINTEND
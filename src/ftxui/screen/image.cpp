@@ -1,7 +1,8 @@
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
-#include <sstream>  // IWYU pragma: keep
+#include <algorithm>  // for fill, max, min
+#include <sstream>    // IWYU pragma: keep
 #include <string>
 #include <vector>
 
@@ -21,19 +22,19 @@ Image::Image(int dimx, int dimy)
     : stencil{0, dimx - 1, 0, dimy - 1},
       dimx_(dimx),
       dimy_(dimy),
-      pixels_(dimy, std::vector<Pixel>(dimx)) {}
+      pixels_(dimx * dimy) {}
 
 /// @brief Access a character in a cell at a given position.
 /// @param x The cell position along the x-axis.
 /// @param y The cell position along the y-axis.
-std::string& Image::at(int x, int y) {
+Grapheme& Image::at(int x, int y) {
   return PixelAt(x, y).character;
 }
 
 /// @brief Access a character in a cell at a given position.
 /// @param x The cell position along the x-axis.
 /// @param y The cell position along the y-axis.
-const std::string& Image::at(int x, int y) const {
+const Grapheme& Image::at(int x, int y) const {
   return PixelAt(x, y).character;
 }
 
@@ -41,23 +42,59 @@ const std::string& Image::at(int x, int y) const {
 /// @param x The cell position along the x-axis.
 /// @param y The cell position along the y-axis.
 Pixel& Image::PixelAt(int x, int y) {
-  return stencil.Contain(x, y) ? pixels_[y][x] : dev_null_pixel();
+  return stencil.Contain(x, y) ? pixels_[y * dimx_ + x] : dev_null_pixel();
 }
 
 /// @brief Access a cell (Pixel) at a given position.
 /// @param x The cell position along the x-axis.
 /// @param y The cell position along the y-axis.
 const Pixel& Image::PixelAt(int x, int y) const {
-  return stencil.Contain(x, y) ? pixels_[y][x] : dev_null_pixel();
+  return stencil.Contain(x, y) ? pixels_[y * dimx_ + x] : dev_null_pixel();
+}
+
+/// @brief Access a row of pixels.
+/// @param y The row position along the y-axis. It must be inside the image.
+Span<Pixel> Image::Row(int y) {
+  return {pixels_.data() + y * dimx_, dimx_};
+}
+
+/// @brief Access a row of pixels.
+/// @param y The row position along the y-axis. It must be inside the image.
+Span<const Pixel> Image::Row(int y) const {
+  return {pixels_.data() + y * dimx_, dimx_};
+}
+
+/// @brief Access the pixels of a row in between two positions, clipped to the
+/// stencil.
+/// @param y The row position along the y-axis.
+/// @param x_min The first cell position along the x-axis.
+/// @param x_max The last cell position along the x-axis, included.
+Span<Pixel> Image::Row(int y, int x_min, int x_max) {
+  if (y < stencil.y_min || y > stencil.y_max) {
+    return {};
+  }
+  x_min = std::max(x_min, stencil.x_min);
+  x_max = std::min(x_max, stencil.x_max);
+  if (x_min > x_max) {
+    return {};
+  }
+  return {pixels_.data() + y * dimx_ + x_min, x_max - x_min + 1};
 }
 
 /// @brief Clear all the pixel from the screen.
 void Image::Clear() {
-  for (auto& line : pixels_) {
-    for (auto& cell : line) {
-      cell = Pixel();
-    }
-  }
+  std::fill(pixels_.begin(), pixels_.end(), Pixel());
+}
+
+/// @brief Change the dimensions of the image. Every pixel is cleared, and the
+/// stencil covers the whole image.
+/// @param dimx The new width.
+/// @param dimy The new height.
+void Image::Resize(int dimx, int dimy) {
+  dimx_ = dimx;
+  dimy_ = dimy;
+  stencil = {0, dimx - 1, 0, dimy - 1};
+  pixels_.assign(dimx * dimy, Pixel());
 }
 
 }  // namespace ftxui
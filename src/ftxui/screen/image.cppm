@@ -13,4 +13,5 @@ export module ftxui.screen.image;
  */
 export namespace ftxui {
     using ftxui::Image;
+    using ftxui::Span;
 }
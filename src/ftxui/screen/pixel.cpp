@@ -0,0 +1,202 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/screen/pixel.hpp"
+
+#include <algorithm>    // for clamp
+#include <array>        // for array
+#include <atomic>       // for atomic
+#include <cstddef>      // for size_t
+#include <cstdint>      // for uint32_t
+#include <cstring>      // for memcpy
+#include <functional>   // for hash
+#include <memory>       // for unique_ptr, make_unique
+#include <mutex>        // for mutex, lock_guard
+#include <ostream>      // for ostream
+#include <string_view>  // for string_view
+#include <vector>       // for vector
+
+#include "ftxui/screen/string_internal.hpp"  // for StringWidth
+
+namespace ftxui {
+
+namespace {
+
+// The graphemes too long to be stored inline, like flags, emoji sequences or
+// sequences of combining characters.
+//
+// Each one is stored in a slot counting the Graphemes referring to it. The slot
+// is freed with the last of them, and reused. The table is therefore bounded
+// by the graphemes alive. The slots are allocated by chunks, never moved.
+//
+// Every thread caches the graphemes it interned recently, and holds a
+// reference to them. Interning them again doesn't lock. Only creating and
+// freeing a slot does.
+constexpr size_t kChunkSize = 4096;
+constexpr size_t kMaxChunks = 4096;
+constexpr size_t kCapacity = kChunkSize * kMaxChunks;
+constexpr size_t kCacheSize = 256;
+constexpr std::string_view kReplacement = "\xEF\xBF\xBD";  // U+FFFD
+
+struct Slot {
+  std::atomic<uint32_t> references = 0;
+
+  // Written under the mutex, while no Grapheme refers to the slot:
+  std::unique_ptr<char[]> bytes;  // NOLINT
+  size_t size = 0;
+
+  std::string_view view() const { return {bytes.get(), size}; }
+};
+
+struct InternedGraphemes {
+  std::array<std::atomic<Slot*>, kMaxChunks> chunks = {};
+
+  // Owned by the writers, under the mutex:
+  std::mutex mutex;
+  std::array<std::unique_ptr<Slot[]>, kMaxChunks> owned_chunks;  // NOLINT
+  size_t used = 0;  // The number of slots ever used.
+  std::vector<uint32_t> free;
+
+  Slot& At(uint32_t slot) {
+    return chunks[slot / kChunkSize].load(std::memory_order_acquire)
+        [slot % kChunkSize];
+  }
+
+  // Store |value| into a slot, referenced once. Return false if every slot is
+  // used.
+  bool Create(std::string_view value, uint32_t* slot) {
+    const std::lock_guard<std::mutex> lock(mutex);
+    if (!free.empty()) {
+      *slot = free.back();
+      free.pop_back();
+    } else if (used < kCapacity) {
+      if (used % kChunkSize == 0) {
+        const size_t chunk = used / kChunkSize;
+        owned_chunks[chunk] = std::make_unique<Slot[]>(kChunkSize);  // NOLINT
+        chunks[chunk].store(owned_chunks[chunk].get(),
+                            std::memory_order_release);
+      }
+      *slot = static_cast<uint32_t>(used++);
+    } else {
+      return false;
+    }
+
+    Slot& entry = At(*slot);
+    entry.bytes = std::make_unique<char[]>(value.size());  // NOLINT
+    std::memcpy(entry.bytes.get(), value.data(), value.size());
+    entry.size = value.size();
+    entry.references.store(1, std::memory_order_relaxed);
+    return true;
+  }
+
+  void Free(uint32_t slot) {
+    const std::lock_guard<std::mutex> lock(mutex);
+    Slot& entry = At(slot);
+    entry.bytes.reset();
+    entry.size = 0;
+    free.push_back(slot);
+  }
+};
+
+// Never destroyed, so that the Graphemes of static objects can outlive it.
+InternedGraphemes& InternedTable() {
+  static auto* table = new InternedGraphemes();  // NOLINT
+  return *table;
+}
+
+void Reference(uint32_t slot) {
+  InternedTable().At(slot).references.fetch_add(1, std::memory_order_relaxed);
+}
+
+void Unreference(uint32_t slot) {
+  auto& table = InternedTable();
+  if (table.At(slot).references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    table.Free(slot);
+  }
+}
+
+// The slots interned recently by the thread, plus one. 0 if none.
+struct InternedCache {
+  std::array<uint32_t, kCacheSize> slots = {};
+
+  InternedCache() = default;
+  InternedCache(const InternedCache&) = delete;
+  InternedCache& operator=(const InternedCache&) = delete;
+  ~InternedCache() {
+    for (const uint32_t slot : slots) {
+      if (slot != 0) {
+        Unreference(slot - 1);
+      }
+    }
+  }
+};
+
+thread_local InternedCache g_cache;  // NOLINT
+
+static_assert(sizeof(Grapheme) == 8, "Grapheme must stay compact");
+
+int Width(std::string_view value) {
+  // Fast path for printable ASCII characters.
+  if (value.size() == 1 && value[0] >= ' ' && value[0] <= '~') {
+    return 1;
+  }
+  return std::clamp(StringWidth(value), 0, 3);
+}
+
+}  // namespace
+
+Grapheme::Grapheme(std::string_view value)
+    : info_(static_cast<uint8_t>(Width(value) << kWidthShift)) {
+  if (value.size() <= kInlineCapacity) {
+    std::memcpy(data_, value.data(), value.size());  // NOLINT
+    info_ |= static_cast<uint8_t>(value.size());
+    return;
+  }
+
+  auto& table = InternedTable();
+  uint32_t& cached = g_cache.slots[std::hash<std::string_view>()(value) %
+                                   kCacheSize];  // NOLINT
+  uint32_t slot = 0;
+  if (cached != 0 && table.At(cached - 1).view() == value) {
+    slot = cached - 1;
+    ftxui::Reference(slot);
+  } else {
+    if (!table.Create(value, &slot)) {
+      // Every slot is used by a live grapheme.
+      *this = Grapheme(kReplacement);
+      return;
+    }
+    ftxui::Reference(slot);  // For the cache.
+    if (cached != 0) {
+      ftxui::Unreference(cached - 1);
+    }
+    cached = slot + 1;
+  }
+
+  std::memcpy(data_, &slot, sizeof(slot));  // NOLINT
+  info_ |= kInterned;
+}
+
+std::string_view Grapheme::Interned() const {
+  uint32_t slot = 0;
+  std::memcpy(&slot, data_, sizeof(slot));  // NOLINT
+  return InternedTable().At(slot).view();
+}
+
+void Grapheme::Reference() const {
+  uint32_t slot = 0;
+  std::memcpy(&slot, data_, sizeof(slot));  // NOLINT
+  ftxui::Reference(slot);
+}
+
+void Grapheme::Unreference() const {
+  uint32_t slot = 0;
+  std::memcpy(&slot, data_, sizeof(slot));  // NOLINT
+  ftxui::Unreference(slot);
+}
+
+std::ostream& operator<<(std::ostream& out, const Grapheme& grapheme) {
+  return out << grapheme.view();
+}
+
+}  // namespace ftxui
@@ -1,19 +1,21 @@
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
-#include <cstddef>  // for size_t
+#include <algorithm>  // for fill, min
+#include <atomic>     // for atomic
+#include <cstddef>    // for size_t
 #include <cstdint>
-#include <iostream>  // for operator<<, stringstream, basic_ostream, flush, cout, ostream
+#include <iostream>  // for operator<<, basic_ostream, flush, cout, ostream
 #include <limits>
-#include <map>      // for _Rb_tree_const_iterator, map, operator!=, operator==
-#include <sstream>  // IWYU pragma: keep
-#include <utility>  // for pair
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <utility>      // for pair, swap
 
 #include "ftxui/screen/image.hpp"  // for Image
 #include "ftxui/screen/pixel.hpp"  // for Pixel
 #include "ftxui/screen/screen.hpp"
-#include "ftxui/screen/string.hpp"    // for string_width
 #include "ftxui/screen/terminal.hpp"  // for Dimensions, Size
+#include "ftxui/screen/util.hpp"      // for AppendNumber
 
 #if defined(_WIN32)
 #define WIN32_LEAN_AND_MEAN
@@ -67,61 +69,149 @@ void WindowsEmulateVT100Terminal() {
 }
 #endif
 
+// Pack the attributes of a Pixel affecting its style, so that an unchanged style
+// is detected with a single comparison.
+uint32_t StyleKey(const Pixel& pixel) {
+  return uint32_t(pixel.blink) << 0u |              //
+         uint32_t(pixel.bold) << 1u |               //
+         uint32_t(pixel.dim) << 2u |                //
+         uint32_t(pixel.italic) << 3u |             //
+         uint32_t(pixel.inverted) << 4u |           //
+         uint32_t(pixel.underlined) << 5u |         //
+         uint32_t(pixel.underlined_double) << 6u |  //
+         uint32_t(pixel.strikethrough) << 7u |      //
+         uint32_t(pixel.hyperlink) << 8u;           // NOLINT
+}
+
+// Accumulate the parameters of a single SGR sequence.
+class SGRWriter {
+ public:
+  explicit SGRWriter(std::string& out) : out_(out) {}
+  ~SGRWriter() {
+    if (!empty_) {
+      out_ += 'm';
+    }
+  }
+  SGRWriter(const SGRWriter&) = delete;
+  SGRWriter& operator=(const SGRWriter&) = delete;
+
+  // Start a new parameter, and return the buffer to append it to.
+  std::string& Next() {
+    out_ += empty_ ? "\x1B[" : ";";
+    empty_ = false;
+    return out_;
+  }
+
+ private:
+  std::string& out_;
+  bool empty_ = true;
+};
+
 // NOLINTNEXTLINE(readability-function-cognitive-complexity)
 void UpdatePixelStyle(const Screen* screen,
-                      std::stringstream& ss,
+                      std::string& out,
                       const Pixel& prev,
                       const Pixel& next) {
+  if (FTXUI_LIKELY(StyleKey(prev) == StyleKey(next) &&
+                   next.foreground_color == prev.foreground_color &&
+                   next.background_color == prev.background_color)) {
+    return;
+  }
+
   // See https://gist.github.com/egmontkob/eb114294efbcd5adb1944c9f3cb5feda
   if (FTXUI_UNLIKELY(next.hyperlink != prev.hyperlink)) {
-    ss << "\x1B]8;;" << screen->Hyperlink(next.hyperlink) << "\x1B\\";
+    out += "\x1B]8;;";
+    out += screen->Hyperlink(next.hyperlink);
+    out += "\x1B\\";
   }
 
+  // Every other change is emitted as a single SGR sequence.
+  SGRWriter sgr(out);
+
   // Bold
   if (FTXUI_UNLIKELY((next.bold ^ prev.bold) | (next.dim ^ prev.dim))) {
-    // BOLD_AND_DIM_RESET:
-    ss << ((prev.bold && !next.bold) || (prev.dim && !next.dim) ? "\x1B[22m"
-                                                                : "");
-    ss << (next.bold ? "\x1B[1m" : "");  // BOLD_SET
-    ss << (next.dim ? "\x1B[2m" : "");   // DIM_SET
+    if ((prev.bold && !next.bold) || (prev.dim && !next.dim)) {
+      sgr.Next() += "22";  // BOLD_AND_DIM_RESET
+    }
+    if (next.bold) {
+      sgr.Next() += '1';  // BOLD_SET
+    }
+    if (next.dim) {
+      sgr.Next() += '2';  // DIM_SET
+    }
   }
 
   // Underline
   if (FTXUI_UNLIKELY(next.underlined != prev.underlined ||
                      next.underlined_double != prev.underlined_double)) {
-    ss << (next.underlined          ? "\x1B[4m"     // UNDERLINE
-           : next.underlined_double ? "\x1B[21m"    // UNDERLINE_DOUBLE
-                                    : "\x1B[24m");  // UNDERLINE_RESET
+    sgr.Next() += (next.underlined          ? "4"     // UNDERLINE
+                   : next.underlined_double ? "21"    // UNDERLINE_DOUBLE
+                                            : "24");  // UNDERLINE_RESET
   }
 
   // Blink
   if (FTXUI_UNLIKELY(next.blink != prev.blink)) {
-    ss << (next.blink ? "\x1B[5m"     // BLINK_SET
-                      : "\x1B[25m");  // BLINK_RESET
+    sgr.Next() += (next.blink ? "5"     // BLINK_SET
+                              : "25");  // BLINK_RESET
   }
 
   // Inverted
   if (FTXUI_UNLIKELY(next.inverted != prev.inverted)) {
-    ss << (next.inverted ? "\x1B[7m"     // INVERTED_SET
-                         : "\x1B[27m");  // INVERTED_RESET
+    sgr.Next() += (next.inverted ? "7"     // INVERTED_SET
+                                 : "27");  // INVERTED_RESET
   }
 
   // Italics
   if (FTXUI_UNLIKELY(next.italic != prev.italic)) {
-    ss << (next.italic ? "\x1B[3m"     // ITALIC_SET
-                       : "\x1B[23m");  // ITALIC_RESET
+    sgr.Next() += (next.italic ? "3"     // ITALIC_SET
+                               : "23");  // ITALIC_RESET
   }
 
   // StrikeThrough
   if (FTXUI_UNLIKELY(next.strikethrough != prev.strikethrough)) {
-    ss << (next.strikethrough ? "\x1B[9m"     // CROSSED_OUT
-                              : "\x1B[29m");  // CROSSED_OUT_RESET
+    sgr.Next() += (next.strikethrough ? "9"     // CROSSED_OUT
+                                      : "29");  // CROSSED_OUT_RESET
   }
 
   if (FTXUI_UNLIKELY(next.foreground_color != prev.foreground_color ||
                      next.background_color != prev.background_color)) {
-    ss << "\x1B[" + next.foreground_color.Print(false) + "m";
-    ss << "\x1B[" + next.background_color.Print(true) + "m";
+    next.foreground_color.Print(false, sgr.Next());
+    next.background_color.Print(true, sgr.Next());
+  }
+}
+
+// Move the terminal cursor from (|cursor_x|, |cursor_y|) to (|x|, |y|). The
+// cursor only moves downward while printing a screen, so relative movements are
+// enough.
+void MoveCursor(std::string& out,
+                int* cursor_x,
+                int* cursor_y,
+                int x,
+                int y) {
+  if (y > *cursor_y) {
+    out += "\x1B[";
+    util::AppendNumber(out, y - *cursor_y);
+    out += 'B';  // MOVE_DOWN
+    *cursor_y = y;
+  }
+  if (x < *cursor_x) {
+    out += '\r';  // MOVE_LEFT
+    *cursor_x = 0;
+  }
+  if (x > *cursor_x) {
+    out += "\x1B[";
+    util::AppendNumber(out, x - *cursor_x);
+    out += 'C';  // MOVE_RIGHT
+    *cursor_x = x;
+  }
+}
+
+// Append the character drawn by |pixel|. Empty cells are drawn as a space.
+void PrintCharacter(std::string& out, const Pixel& pixel) {
+  if (pixel.character.empty()) {
+    out += ' ';
+  } else {
+    out += pixel.character.view();
   }
 }
 
@@ -132,25 +222,19 @@ struct TileEncoding {
   std::uint8_t down : 2;
   std::uint8_t round : 1;
 
-  // clang-format off
-  bool operator<(const TileEncoding& other) const {
-    if (left < other.left)   { return  true;  }
-    if (left > other.left)   { return  false; }
-    if (top < other.top)     { return  true;  }
-    if (top > other.top)     { return  false; }
-    if (right < other.right) { return  true;  }
-    if (right > other.right) { return  false; }
-    if (down < other.down)   { return  true;  }
-    if (down > other.down)   { return  false; }
-    if (round < other.round) { return  true;  }
-    if (round > other.round) { return  false; }
-      return false;
-  }
-  // clang-format on
+  // A dense index, from 0 to 511.
+  constexpr int Index() const {
+    return left | top << 2 | right << 4 | down << 6 | round << 8;  // NOLINT
+  }
+};
+
+struct Tile {
+  std::string_view glyph;
+  TileEncoding encoding;
 };
 
 // clang-format off
-const std::map<std::string, TileEncoding> tile_encoding = { // NOLINT
+constexpr Tile tile_encoding[] = { // NOLINT
     {"─", {1, 0, 1, 0, 0}},
     {"━", {2, 0, 2, 0, 0}},
     {"╍", {2, 0, 2, 0, 0}},
@@ -293,73 +377,125 @@ const std::map<std::string, TileEncoding> tile_encoding = { // NOLINT
 };
 // clang-format on
 
-template <class A, class B>
-std::map<B, A> InvertMap(const std::map<A, B> input) {
-  std::map<B, A> output;
-  for (const auto& it : input) {
-    output[it.second] = it.first;
+// The box drawing characters are the codepoints U+2500 to U+257F. In UTF8,
+// they are encoded as E2 94 80 to E2 95 BF.
+constexpr int kBoxDrawingCount = 128;
+
+// Return the index of the box drawing character |glyph|, or -1.
+constexpr int BoxDrawingIndex(std::string_view glyph) {
+  if (glyph.size() != 3 || uint8_t(glyph[0]) != 0xE2 ||  // NOLINT
+      uint8_t(glyph[1]) < 0x94 || uint8_t(glyph[1]) > 0x95 ||  // NOLINT
+      uint8_t(glyph[2]) < 0x80 || uint8_t(glyph[2]) > 0xBF) {  // NOLINT
+    return -1;
+  }
+  return (uint8_t(glyph[1]) - 0x94) * 64 + (uint8_t(glyph[2]) - 0x80);  // NOLINT
+}
+
+Grapheme BoxDrawingGlyph(int index) {
+  const char glyph[3] = {
+      char(0xE2),                // NOLINT
+      char(0x94 + index / 64),   // NOLINT
+      char(0x80 + index % 64),   // NOLINT
+  };
+  return std::string_view(glyph, 3);  // NOLINT
+}
+
+// The tile_encoding table, indexed by codepoint, and its inverse.
+struct TileTables {
+  bool has_encoding[kBoxDrawingCount] = {};     // NOLINT
+  TileEncoding encoding[kBoxDrawingCount] = {};  // NOLINT
+  int16_t glyph[512] = {};                       // NOLINT
+};
+
+constexpr TileTables BuildTileTables() {
+  TileTables tables;
+  for (int16_t& glyph : tables.glyph) {
+    glyph = -1;
+  }
+  // When several characters share an encoding, the last one in codepoint order
+  // is chosen.
+  for (int index = 0; index < kBoxDrawingCount; ++index) {
+    for (const Tile& tile : tile_encoding) {
+      if (BoxDrawingIndex(tile.glyph) == index) {
+        tables.has_encoding[index] = true;          // NOLINT
+        tables.encoding[index] = tile.encoding;     // NOLINT
+        tables.glyph[tile.encoding.Index()] = int16_t(index);  // NOLINT
+      }
+    }
+  }
+  return tables;
+}
+
+constexpr TileTables tile_tables = BuildTileTables();
+
+// Return the index of the box drawing character drawn by |grapheme|, if it has
+// a TileEncoding, or -1.
+int TileIndex(const Grapheme& grapheme) {
+  const int index = BoxDrawingIndex(grapheme.view());
+  if (index == -1 || !tile_tables.has_encoding[index]) {  // NOLINT
+    return -1;
   }
-  return output;
+  return index;
 }
 
-const std::map<TileEncoding, std::string> tile_encoding_inverse =  // NOLINT
-    InvertMap(tile_encoding);
+// Replace |grapheme| by the character drawn by |encoding|, if any.
+void Upgrade(Grapheme& grapheme, TileEncoding encoding) {
+  const int index = tile_tables.glyph[encoding.Index()];  // NOLINT
+  if (index != -1) {
+    grapheme = BoxDrawingGlyph(index);
+  }
+}
 
-void UpgradeLeftRight(std::string& left, std::string& right) {
-  const auto it_left = tile_encoding.find(left);
-  if (it_left == tile_encoding.end()) {
+void UpgradeLeftRight(Grapheme& left, Grapheme& right) {
+  const int index_left = TileIndex(left);
+  if (index_left == -1) {
     return;
   }
-  const auto it_right = tile_encoding.find(right);
-  if (it_right == tile_encoding.end()) {
+  const int index_right = TileIndex(right);
+  if (index_right == -1) {
     return;
   }
 
-  if (it_left->second.right == 0 && it_right->second.left != 0) {
-    TileEncoding encoding_left = it_left->second;
-    encoding_left.right = it_right->second.left;
-    const auto it_left_upgrade = tile_encoding_inverse.find(encoding_left);
-    if (it_left_upgrade != tile_encoding_inverse.end()) {
-      left = it_left_upgrade->second;
-    }
+  const TileEncoding encoding_left = tile_tables.encoding[index_left];  // NOLINT
+  const TileEncoding encoding_right =
+      tile_tables.encoding[index_right];  // NOLINT
+
+  if (encoding_left.right == 0 && encoding_right.left != 0) {
+    TileEncoding upgraded = encoding_left;
+    upgraded.right = encoding_right.left;
+    Upgrade(left, upgraded);
   }
 
-  if (it_right->second.left == 0 && it_left->second.right != 0) {
-    TileEncoding encoding_right = it_right->second;
-    encoding_right.left = it_left->second.right;
-    const auto it_right_upgrade = tile_encoding_inverse.find(encoding_right);
-    if (it_right_upgrade != tile_encoding_inverse.end()) {
-      right = it_right_upgrade->second;
-    }
+  if (encoding_right.left == 0 && encoding_left.right != 0) {
+    TileEncoding upgraded = encoding_right;
+    upgraded.left = encoding_left.right;
+    Upgrade(right, upgraded);
   }
 }
 
-void UpgradeTopDown(std::string& top, std::string& down) {
-  const auto it_top = tile_encoding.find(top);
-  if (it_top == tile_encoding.end()) {
+void UpgradeTopDown(Grapheme& top, Grapheme& down) {
+  const int index_top = TileIndex(top);
+  if (index_top == -1) {
     return;
   }
-  const auto it_down = tile_encoding.find(down);
-  if (it_down == tile_encoding.end()) {
+  const int index_down = TileIndex(down);
+  if (index_down == -1) {
     return;
   }
 
-  if (it_top->second.down == 0 && it_down->second.top != 0) {
-    TileEncoding encoding_top = it_top->second;
-    encoding_top.down = it_down->second.top;
-    const auto it_top_down = tile_encoding_inverse.find(encoding_top);
-    if (it_top_down != tile_encoding_inverse.end()) {
-      top = it_top_down->second;
-    }
+  const TileEncoding encoding_top = tile_tables.encoding[index_top];  // NOLINT
+  const TileEncoding encoding_down = tile_tables.encoding[index_down];  // NOLINT
+
+  if (encoding_top.down == 0 && encoding_down.top != 0) {
+    TileEncoding upgraded = encoding_top;
+    upgraded.down = encoding_down.top;
+    Upgrade(top, upgraded);
   }
 
-  if (it_down->second.top == 0 && it_top->second.down != 0) {
-    TileEncoding encoding_down = it_down->second;
-    encoding_down.top = it_top->second.down;
-    const auto it_down_top = tile_encoding_inverse.find(encoding_down);
-    if (it_down_top != tile_encoding_inverse.end()) {
-      down = it_down_top->second;
-    }
+  if (encoding_down.top == 0 && encoding_top.down != 0) {
+    TileEncoding upgraded = encoding_down;
+    upgraded.top = encoding_top.down;
+    Upgrade(down, upgraded);
   }
 }
 
@@ -413,39 +549,128 @@ Screen::Screen(int dimx, int dimy) : Image{dimx, dimy} {
 /// @note Don't forget to flush stdout. Alternatively, you can use
 /// Screen::Print();
 std::string Screen::ToString() const {
-  std::stringstream ss;
+  std::string out;
+  ToString(out);
+  return out;
+}
 
+/// Append to |out| the string printing the Screen on the terminal.
+/// @note Reusing the same |out| across frames, after clearing it, avoids any
+/// allocation once its capacity is large enough.
+void Screen::ToString(std::string& out) const {
   const Pixel default_pixel;
   const Pixel* previous_pixel_ref = &default_pixel;
 
   for (int y = 0; y < dimy_; ++y) {
     // New line in between two lines.
     if (y != 0) {
-      UpdatePixelStyle(this, ss, *previous_pixel_ref, default_pixel);
+      UpdatePixelStyle(this, out, *previous_pixel_ref, default_pixel);
       previous_pixel_ref = &default_pixel;
-      ss << "\r\n";
+      out += "\r\n";
     }
 
     // After printing a fullwith character, we need to skip the next cell.
     bool previous_fullwidth = false;
-    for (const auto& pixel : pixels_[y]) {
+    for (const auto& pixel : Row(y)) {
       if (!previous_fullwidth) {
-        UpdatePixelStyle(this, ss, *previous_pixel_ref, pixel);
+        UpdatePixelStyle(this, out, *previous_pixel_ref, pixel);
         previous_pixel_ref = &pixel;
-        if (pixel.character.empty()) {
-          ss << " ";
-        } else {
-          ss << pixel.character;
-        }
+        PrintCharacter(out, pixel);
       }
-      previous_fullwidth = (string_width(pixel.character) == 2);
+      previous_fullwidth = (pixel.character.width() == 2);
     }
   }
 
   // Reset the style to default:
-  UpdatePixelStyle(this, ss, *previous_pixel_ref, default_pixel);
+  UpdatePixelStyle(this, out, *previous_pixel_ref, default_pixel);
+}
+
+/// Produce a std::string updating a terminal displaying |previous| into this
+/// Screen. Only the cells that changed are printed, using cursor movements to
+/// skip over the others.
+/// @note The terminal cursor is expected at the top-left corner of the
+/// drawing, see Screen::ResetPosition(). It is left at the same position as
+/// after printing Screen::ToString().
+/// @note If the dimensions differ, the whole screen is printed.
+std::string Screen::ToString(const Screen& previous) const {
+  std::string out;
+  ToString(previous, out);
+  return out;
+}
+
+/// Append to |out| the string updating a terminal displaying |previous| into
+/// this Screen. See Screen::ToString(const Screen&).
+void Screen::ToString(const Screen& previous, std::string& out) const {
+  if (previous.dimx_ != dimx_ || previous.dimy_ != dimy_) {
+    ToString(out);
+    return;
+  }
+
+  const Pixel default_pixel;
+  const Pixel* previous_pixel_ref = &default_pixel;
+
+  // Hyperlink ids can be compared directly when issued by the same registry.
+  // Otherwise, the links must be compared, if they are known.
+  const bool same_hyperlinks =
+      pixels_hyperlinks_id_ != 0 &&
+      pixels_hyperlinks_id_ == previous.pixels_hyperlinks_id_;
+  const bool known_hyperlinks =
+      pixels_hyperlinks_id_ == hyperlinks_id_.value() &&
+      previous.pixels_hyperlinks_id_ == previous.hyperlinks_id_.value();
+
+  int cursor_x = 0;
+  int cursor_y = 0;
+  for (int y = 0; y < dimy_; ++y) {
+    const Span<const Pixel> row = Row(y);
+    const Span<const Pixel> previous_row = previous.Row(y);
+
+    // After printing a fullwith character, we need to skip the next cell.
+    bool previous_fullwidth = false;
+
+    // Whether the previous cell was printed over a fullwidth character. The
+    // current cell was covered by it and must be printed again.
+    bool previous_overwritten = false;
+
+    for (int x = 0; x < dimx_; ++x) {
+      const Pixel& pixel = row[x];
+      const Pixel& old_pixel = previous_row[x];
+      const bool fullwidth = pixel.character.width() == 2;
+      const bool old_fullwidth = old_pixel.character.width() == 2;
+
+      if (previous_fullwidth) {
+        previous_fullwidth = fullwidth;
+        previous_overwritten = previous_overwritten && old_fullwidth;
+        continue;
+      }
+      previous_fullwidth = fullwidth;
+
+      bool dirty = previous_overwritten || pixel != old_pixel;
+      if (!dirty && !same_hyperlinks && pixel.hyperlink != 0) {
+        dirty = !known_hyperlinks || Hyperlink(pixel.hyperlink) !=
+                                         previous.Hyperlink(old_pixel.hyperlink);
+      }
+
+      // The last cell is always printed, so that the cursor ends at the same
+      // position as with a full repaint.
+      if (y == dimy_ - 1 && x + (fullwidth ? 2 : 1) >= dimx_) {
+        dirty = true;
+      }
+
+      previous_overwritten = dirty && (fullwidth || old_fullwidth);
+      if (!dirty) {
+        continue;
+      }
+
+      MoveCursor(out, &cursor_x, &cursor_y, x, y);
+      UpdatePixelStyle(this, out, *previous_pixel_ref, pixel);
+      previous_pixel_ref = &pixel;
+      PrintCharacter(out, pixel);
+      cursor_x = x + (fullwidth ? 2 : 1);
+    }
+  }
 
-  return ss.str();
+  // Reset the style to default:
+  UpdatePixelStyle(this, out, *previous_pixel_ref, default_pixel);
 }
 
 // Print the Screen to the terminal.
@@ -473,21 +698,23 @@ void Screen::Print() const {
 /// @return The string to print in order to reset the cursor position to the
 ///         beginning.
 std::string Screen::ResetPosition(bool clear) const {
-  std::stringstream ss;
+  std::string out;
   if (clear) {
-    ss << "\r";       // MOVE_LEFT;
-    ss << "\x1b[2K";  // CLEAR_SCREEN;
+    out += "\r";       // MOVE_LEFT;
+    out += "\x1b[2K";  // CLEAR_SCREEN;
     for (int y = 1; y < dimy_; ++y) {
-      ss << "\x1B[1A";  // MOVE_UP;
-      ss << "\x1B[2K";  // CLEAR_LINE;
+      out += "\x1B[1A";  // MOVE_UP;
+      out += "\x1B[2K";  // CLEAR_LINE;
     }
   } else {
-    ss << "\r";  // MOVE_LEFT;
-    for (int y = 1; y < dimy_; ++y) {
-      ss << "\x1B[1A";  // MOVE_UP;
+    out += "\r";  // MOVE_LEFT;
+    if (dimy_ > 1) {
+      out += "\x1B[";
+      util::AppendNumber(out, dimy_ - 1);
+      out += "A";  // MOVE_UP;
     }
   }
-  return ss.str();
+  return out;
 }
 
 /// @brief Clear all the pixel from the screen.
@@ -497,30 +724,59 @@ void Screen::Clear() {
   cursor_.x = dimx_ - 1;
   cursor_.y = dimy_ - 1;
 
-  hyperlinks_ = {
-      "",
-  };
+  // The hyperlinks are kept, so that their ids are stable across frames, unless
+  // no id is left.
+  if (hyperlinks_.size() > std::numeric_limits<uint16_t>::max()) {
+    hyperlinks_ = {
+        "",
+    };
+    hyperlink_ids_.clear();
+    hyperlinks_id_ = HyperlinkRegistryId();
+  }
+  pixels_hyperlinks_id_ = hyperlinks_id_.value();
+
+  std::fill(automerge_rows_.begin(), automerge_rows_.end(), false);
+}
+
+/// @brief Record that the row |y| contains pixels with Pixel::automerge set.
+/// Screen::ApplyShader() only visits the rows recorded since the last
+/// Screen::Clear().
+void Screen::MarkAutomerge(int y) {
+  if (y < 0 || y >= dimy_) {
+    return;
+  }
+  if (automerge_rows_.size() < static_cast<size_t>(dimy_)) {
+    automerge_rows_.resize(dimy_, false);
+  }
+  automerge_rows_[y] = true;
 }
 
 // clang-format off
 void Screen::ApplyShader() {
-  // Merge box characters togethers.
-  for (int y = 0; y < dimy_; ++y) {
+  // Merge box characters togethers, in the rows containing some.
+  const int rows = std::min(dimy_, static_cast<int>(automerge_rows_.size()));
+  for (int y = 0; y < rows; ++y) {
+    if (!automerge_rows_[y]) {
+      continue;
+    }
+    const bool merge_top = y > 0 && automerge_rows_[y - 1];
+    const Span<Pixel> row = Row(y);
+    const Span<Pixel> row_top = merge_top ? Row(y - 1) : Span<Pixel>();
     for (int x = 0; x < dimx_; ++x) {
       // Box drawing character uses exactly 3 byte.
-      Pixel& cur = pixels_[y][x];
+      Pixel& cur = row[x];
       if (!ShouldAttemptAutoMerge(cur)) {
         continue;
       }
 
       if (x > 0) {
-        Pixel& left = pixels_[y][x-1];
+        Pixel& left = row[x-1];
         if (ShouldAttemptAutoMerge(left)) {
           UpgradeLeftRight(left.character, cur.character);
         }
       }
-      if (y > 0) {
-        Pixel& top = pixels_[y-1][x];
+      if (merge_top) {
+        Pixel& top = row_top[x];
         if (ShouldAttemptAutoMerge(top)) {
           UpgradeTopDown(top.character, cur.character);
         }
@@ -530,26 +786,60 @@ void Screen::ApplyShader() {
 }
 // clang-format on
 
-std::uint8_t Screen::RegisterHyperlink(const std::string& link) {
-  for (std::size_t i = 0; i < hyperlinks_.size(); ++i) {
-    if (hyperlinks_[i] == link) {
-      return i;
-    }
+/// @brief Exchange the pixels and the dimensions with |other|.
+/// This is used to retain the previous frame without copying it.
+/// @note The hyperlink registries are not exchanged. The hyperlink ids of the
+/// pixels keep referring to the registry of the screen that issued them.
+void Screen::Swap(Screen& other) {
+  std::swap(dimx_, other.dimx_);
+  std::swap(dimy_, other.dimy_);
+  std::swap(stencil, other.stencil);
+  std::swap(pixels_, other.pixels_);
+  std::swap(pixels_hyperlinks_id_, other.pixels_hyperlinks_id_);
+  std::swap(automerge_rows_, other.automerge_rows_);
+}
+
+std::uint16_t Screen::RegisterHyperlink(const std::string& link) {
+  // The pixels may now mix ids from this registry and another one.
+  if (pixels_hyperlinks_id_ != hyperlinks_id_.value()) {
+    pixels_hyperlinks_id_ = 0;
   }
-  if (hyperlinks_.size() == std::numeric_limits<std::uint8_t>::max()) {
+
+  const auto it = hyperlink_ids_.find(link);
+  if (it != hyperlink_ids_.end()) {
+    return it->second;
+  }
+  if (link.empty() ||
+      hyperlinks_.size() > std::numeric_limits<std::uint16_t>::max()) {
     return 0;
   }
+  const auto id = static_cast<std::uint16_t>(hyperlinks_.size());
   hyperlinks_.push_back(link);
-  return hyperlinks_.size() - 1;
+  hyperlink_ids_.emplace(link, id);
+  return id;
 }
 
-const std::string& Screen::Hyperlink(std::uint8_t id) const {
+const std::string& Screen::Hyperlink(std::uint16_t id) const {
   if (id >= hyperlinks_.size()) {
     return hyperlinks_[0];
   }
   return hyperlinks_[id];
 }
 
+Screen::HyperlinkRegistryId::HyperlinkRegistryId() {
+  static std::atomic<uint64_t> next_id{1};
+  value_ = next_id++;
+}
+
+Screen::HyperlinkRegistryId::HyperlinkRegistryId(const HyperlinkRegistryId&)
+    : HyperlinkRegistryId() {}
+
+Screen::HyperlinkRegistryId& Screen::HyperlinkRegistryId::operator=(
+    const HyperlinkRegistryId&) {
+  value_ = HyperlinkRegistryId().value_;
+  return *this;
+}
+
 /// @brief Return the current selection style.
 /// @see SetSelectionStyle
 const Screen::SelectionStyle& Screen::GetSelectionStyle() const {
@@ -0,0 +1,291 @@
+// Copyright 2025 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/screen/screen.hpp"
+#include <gtest/gtest.h>
+#include <climits>  // for INT_MAX, INT_MIN
+#include <string>   // for allocator, string, to_string
+#include <utility>  // for move
+#include <vector>   // for vector
+#include "ftxui/screen/terminal.hpp"  // for SetColorSupport, Color, TrueColor
+#include "ftxui/screen/util.hpp"      // for AppendNumber
+
+namespace ftxui {
+
+namespace {
+
+void Write(Screen& screen, int y, const std::string& line) {
+  for (int x = 0; x < screen.dimx() && x < (int)line.size(); ++x) {
+    screen.at(x, y) = line.substr(x, 1);
+  }
+}
+
+}  // namespace
+
+TEST(ScreenTest, DiffUnchanged) {
+  Screen previous(3, 2);
+  Write(previous, 0, "abc");
+  Write(previous, 1, "def");
+  Screen screen(3, 2);
+  Write(screen, 0, "abc");
+  Write(screen, 1, "def");
+
+  // Only the last cell is printed, to move the cursor to the end.
+  EXPECT_EQ(screen.ToString(previous), "\x1B[1B\x1B[2Cf");
+}
+
+TEST(ScreenTest, DiffSingleCell) {
+  Screen previous(3, 2);
+  Write(previous, 0, "abc");
+  Write(previous, 1, "def");
+  Screen screen(3, 2);
+  Write(screen, 0, "axc");
+  Write(screen, 1, "def");
+
+  EXPECT_EQ(screen.ToString(previous), "\x1B[1Cx\x1B[1Bf");
+}
+
+TEST(ScreenTest, DiffRuns) {
+  Screen previous(4, 2);
+  Write(previous, 0, "abcd");
+  Write(previous, 1, "efgh");
+  Screen screen(4, 2);
+  Write(screen, 0, "xycd");
+  Write(screen, 1, "ezgh");
+
+  EXPECT_EQ(screen.ToString(previous), "xy\x1B[1B\r\x1B[1Cz\x1B[1Ch");
+}
+
+TEST(ScreenTest, DiffStyle) {
+  Screen previous(3, 1);
+  Write(previous, 0, "abc");
+  Screen screen(3, 1);
+  Write(screen, 0, "abc");
+  screen.PixelAt(1, 0).bold = true;
+
+  EXPECT_EQ(screen.ToString(previous), "\x1B[1C\x1B[1mb\x1B[22mc");
+}
+
+TEST(ScreenTest, DiffFullwidth) {
+  Screen previous(3, 1);
+  previous.at(0, 0) = "测";
+  previous.at(2, 0) = "c";
+  Screen screen(3, 1);
+  Write(screen, 0, "abc");
+
+  // The cell covered by the previous fullwidth character is printed again.
+  EXPECT_EQ(screen.ToString(previous), "abc");
+}
+
+TEST(ScreenTest, DiffResized) {
+  Screen previous(2, 2);
+  Screen screen(3, 1);
+  Write(screen, 0, "abc");
+
+  EXPECT_EQ(screen.ToString(previous), screen.ToString());
+}
+
+TEST(ScreenTest, ToStringAppend) {
+  Terminal::SetColorSupport(Terminal::Color::TrueColor);
+  Screen previous(3, 1);
+  Write(previous, 0, "abc");
+  Screen screen(3, 1);
+  Write(screen, 0, "axc");
+  screen.PixelAt(1, 0).foreground_color = Color::RGB(1, 20, 255);
+
+  std::string out = "prefix";
+  screen.ToString(out);
+  EXPECT_EQ(out, "prefix" + screen.ToString());
+
+  out.clear();
+  screen.ToString(previous, out);
+  EXPECT_EQ(out, screen.ToString(previous));
+  EXPECT_EQ(out, "\x1B[1C\x1B[38;2;1;20;255;49mx\x1B[39;49mc");
+}
+
+TEST(ScreenTest, CombinedStyle) {
+  Terminal::SetColorSupport(Terminal::Color::TrueColor);
+  Screen screen(2, 1);
+  Write(screen, 0, "ab");
+  Pixel& pixel = screen.PixelAt(0, 0);
+  pixel.bold = true;
+  pixel.underlined = true;
+  pixel.italic = true;
+  pixel.foreground_color = Color::Palette256(52);
+  pixel.background_color = Color::Red;
+
+  // Every style change of a transition is printed as a single sequence.
+  EXPECT_EQ(screen.ToString(), "\x1B[1;4;3;38;5;52;41ma\x1B[22;24;23;39;49mb");
+}
+
+TEST(ScreenTest, ApplyShader) {
+  Screen screen(2, 2);
+  screen.at(0, 0) = "─";
+  screen.at(1, 0) = "│";
+  screen.at(0, 1) = "│";
+  for (int y = 0; y < 2; ++y) {
+    for (int x = 0; x < 2; ++x) {
+      screen.PixelAt(x, y).automerge = true;
+    }
+  }
+
+  // Rows not marked are skipped.
+  screen.ApplyShader();
+  EXPECT_EQ(screen.ToString(), "─│\r\n│ ");
+
+  screen.MarkAutomerge(0);
+  screen.MarkAutomerge(1);
+  screen.ApplyShader();
+  EXPECT_EQ(screen.ToString(), "┬┤\r\n│ ");
+}
+
+TEST(ScreenTest, Hyperlink) {
+  Screen screen(1, 1);
+  EXPECT_EQ(screen.RegisterHyperlink(""), 0);
+  const uint16_t a = screen.RegisterHyperlink("https://a.com");
+  EXPECT_NE(a, 0);
+  EXPECT_EQ(screen.RegisterHyperlink("https://a.com"), a);
+  EXPECT_EQ(screen.Hyperlink(a), "https://a.com");
+
+  // More ids than an uint8_t can hold:
+  for (int i = 0; i < 1000; ++i) {
+    const std::string link = "https://" + std::to_string(i) + ".com";
+    EXPECT_EQ(screen.Hyperlink(screen.RegisterHyperlink(link)), link);
+  }
+
+  // Ids are stable across frames.
+  screen.Clear();
+  EXPECT_EQ(screen.RegisterHyperlink("https://a.com"), a);
+}
+
+TEST(ScreenTest, DiffHyperlink) {
+  Screen screen(2, 1);
+  Screen front(2, 1);
+  Write(screen, 0, "ab");
+  screen.PixelAt(0, 0).hyperlink = screen.RegisterHyperlink("https://a.com");
+  screen.Swap(front);
+  screen.Clear();
+  Write(screen, 0, "ab");
+  screen.PixelAt(0, 0).hyperlink = screen.RegisterHyperlink("https://a.com");
+  EXPECT_EQ(screen.ToString(front), "\x1B[1Cb");
+
+  // The same id, from another registry:
+  Screen other(2, 1);
+  Write(other, 0, "ab");
+  other.PixelAt(0, 0).hyperlink = other.RegisterHyperlink("https://b.com");
+  EXPECT_EQ(other.ToString(front),
+            "\x1B]8;;https://b.com\x1B\\a\x1B]8;;\x1B\\b");
+}
+
+TEST(ScreenTest, Swap) {
+  Screen a(2, 1);
+  Write(a, 0, "ab");
+  Screen b(2, 1);
+  Write(b, 0, "cd");
+  a.Swap(b);
+  EXPECT_EQ(a.ToString(), "cd");
+  EXPECT_EQ(b.ToString(), "ab");
+}
+
+TEST(ScreenTest, Row) {
+  Screen screen(3, 2);
+  Write(screen, 0, "abc");
+  Write(screen, 1, "def");
+  EXPECT_EQ(screen.Row(1).size(), 3);
+  EXPECT_EQ(screen.Row(1)[0].character, "d");
+
+  // Clipped to the stencil:
+  screen.stencil = {1, 1, 0, 0};
+  EXPECT_EQ(screen.Row(0, 0, 2).size(), 1);
+  EXPECT_EQ(screen.Row(0, 0, 2)[0].character, "b");
+  EXPECT_TRUE(screen.Row(1, 0, 2).empty());
+  EXPECT_TRUE(screen.Row(0, 2, 2).empty());
+}
+
+TEST(ScreenTest, Resize) {
+  Screen screen(3, 2);
+  Write(screen, 0, "abc");
+  screen.Resize(2, 3);
+  EXPECT_EQ(screen.dimx(), 2);
+  EXPECT_EQ(screen.dimy(), 3);
+  EXPECT_EQ(screen.ToString(), "  \r\n  \r\n  ");
+  screen.at(1, 2) = "x";
+  EXPECT_EQ(screen.ToString(), "  \r\n  \r\n x");
+}
+
+TEST(ScreenTest, GraphemeInline) {
+  Grapheme grapheme = "测";
+  EXPECT_EQ(grapheme.size(), 3u);
+  EXPECT_EQ(grapheme, "测");
+  EXPECT_NE(grapheme, "a");
+  EXPECT_EQ(std::string(grapheme), "测");
+  EXPECT_TRUE(Grapheme().empty());
+  EXPECT_EQ(Grapheme(), "");
+}
+
+TEST(ScreenTest, GraphemeWidth) {
+  EXPECT_EQ(Grapheme().width(), 0);
+  EXPECT_EQ(Grapheme("a").width(), 1);
+  EXPECT_EQ(Grapheme("测").width(), 2);
+  EXPECT_EQ(Grapheme("a\u0301").width(), 1);
+  EXPECT_EQ(Grapheme("a\u0301\u0302\u0303\u0304").width(), 1);
+}
+
+TEST(ScreenTest, GraphemeInterned) {
+  // A glyph followed by several combining characters doesn't fit inline.
+  const std::string long_grapheme = "a\u0301\u0302\u0303\u0304";
+  Grapheme a = long_grapheme;
+  Grapheme b = std::string(long_grapheme);
+  EXPECT_EQ(a.size(), long_grapheme.size());
+  EXPECT_EQ(a, long_grapheme);
+  EXPECT_EQ(a, b);
+  EXPECT_NE(a, Grapheme("a"));
+
+  Screen screen(1, 1);
+  screen.at(0, 0) = long_grapheme;
+  EXPECT_EQ(screen.ToString(), long_grapheme);
+}
+
+TEST(ScreenTest, GraphemeInternedLifetime) {
+  const std::string first_value = "first\u0301\u0302";
+  const Grapheme first = first_value;
+  const std::string_view first_view = first.view();
+
+  // Streaming many distinct long graphemes doesn't grow the table forever.
+  // Those still alive keep their value.
+  std::vector<Grapheme> kept;
+  for (int i = 0; i < 200000; ++i) {
+    const Grapheme grapheme = "long grapheme " + std::to_string(i);
+    EXPECT_EQ(grapheme.size(), 14 + std::to_string(i).size());
+    if (i % 2 == 0) {
+      kept.push_back(grapheme);
+    }
+  }
+
+  EXPECT_EQ(first, first_value);
+  EXPECT_EQ(first.view().data(), first_view.data());
+  for (size_t i = 0; i < kept.size(); ++i) {
+    EXPECT_EQ(kept[i], "long grapheme " + std::to_string(2 * i));
+  }
+
+  // Copies and moves share the entry.
+  Grapheme copy = kept.back();
+  Grapheme moved = std::move(kept.back());
+  kept.clear();
+  EXPECT_EQ(copy, moved);
+  EXPECT_EQ(copy.view().data(), moved.view().data());
+  EXPECT_EQ(moved, "long grapheme 199998");
+  copy = Grapheme("a");
+  EXPECT_EQ(copy, "a");
+  EXPECT_EQ(moved, "long grapheme 199998");
+}
+
+TEST(ScreenTest, AppendNumber) {
+  for (int value : {0, 7, 42, 1000, -1, -42, INT_MAX, INT_MIN}) {
+    std::string out = "x";
+    util::AppendNumber(out, value);
+    EXPECT_EQ(out, "x" + std::to_string(value));
+  }
+}
+
+}  // namespace ftxui
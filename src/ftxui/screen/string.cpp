@@ -5,6 +5,9 @@
 // Content of this file was created thanks to:
 // -
 // https://www.unicode.org/Public/UCD/latest/ucd/auxiliary/WordBreakProperty.txt
+// -
+// https://www.unicode.org/Public/UCD/latest/ucd/auxiliary/GraphemeBreakProperty.txt
+// - https://www.unicode.org/reports/tr29/
 // - Markus Kuhn -- 2007-05-26 (Unicode 5.0)
 //   http://www.cl.cam.ac.uk/~mgk25/ucs/wcwidth.c
 // Thanks you!
@@ -14,12 +17,14 @@
 #include <array>    // for array
 #include <cstddef>  // for size_t
 #include <cstdint>  // for uint32_t, uint8_t, uint16_t, int32_t
-#include <string>   // for string, basic_string, wstring
-#include <tuple>    // for _Swallow_assign, ignore
+#include <string>       // for string, basic_string, wstring
+#include <string_view>  // for string_view
 #include <vector>
 
-#include "ftxui/screen/color.hpp"            // for Color
-#include "ftxui/screen/colored_string.hpp"
+#if defined(__SSE2__)
+#include <emmintrin.h>  // for _mm_loadu_si128, _mm_cmpgt_epi8, _mm_movemask_epi8
+#endif
+
 #include "ftxui/screen/deprecated.hpp"       // for wchar_width, wstring_width
 #include "ftxui/screen/string_internal.hpp"  // for WordBreakProperty, EatCodePoint, CodepointToWordBreakProperty, GlyphCount, GlyphIterate, GlyphNext, GlyphPrevious, IsCombining, IsControl, IsFullWidth, Utf8ToWordBreakProperty
 
@@ -1078,75 +1083,301 @@ constexpr std::array<WordBreakPropertyInterval, 993> g_word_break_intervals = {{
     {0xE0100, 0xE01EF, WBP::Extend},
 }};
 
-// Construct table of just WBP::Extend character intervals
-constexpr auto g_extend_characters{[]() constexpr {
-  // Compute number of extend character intervals
-  constexpr size_t size = []() constexpr {
-    size_t count = 0;
-    for (auto interval : g_word_break_intervals) {
-      if (interval.property == WBP::Extend) {
-        count++;
-      }
+// The Grapheme_Cluster_Break property, and Extended_Pictographic. CR and LF are
+// Control: a CR is never drawn, and a LF is a glyph of its own.
+enum class GraphemeClass : uint8_t {
+  Other,
+  Control,
+  Extend,
+  ZWJ,
+  RegionalIndicator,
+  Prepend,
+  SpacingMark,
+  L,
+  V,
+  T,
+  LV,  // In the tables, LV also stands for LVT. See GraphemeClassOf().
+  LVT,
+  ExtendedPictographic,
+};
+using GCB = GraphemeClass;
+constexpr size_t kGraphemeClassCount = 13;
+
+struct GraphemeClassInterval {
+  uint32_t first;
+  uint32_t last;
+  GCB property;
+};
+
+// Extend, ZWJ and Regional_Indicator match the word break property, and are
+// read from |g_word_break_intervals|. The SpacingMark characters are mostly
+// word break Extend. Only the others are listed here. As of Unicode 14.0.0:
+// https://www.unicode.org/Public/UCD/latest/ucd/auxiliary/GraphemeBreakProperty.txt
+// https://www.unicode.org/Public/UCD/latest/ucd/emoji/emoji-data.txt
+constexpr std::array<GraphemeClassInterval, 103> g_grapheme_class_intervals = {{
+    {0x00000, 0x0001F, GCB::Control},
+    {0x0007F, 0x0009F, GCB::Control},
+    {0x000A9, 0x000A9, GCB::ExtendedPictographic},
+    {0x000AE, 0x000AE, GCB::ExtendedPictographic},
+    {0x00600, 0x00605, GCB::Prepend},
+    {0x006DD, 0x006DD, GCB::Prepend},
+    {0x0070F, 0x0070F, GCB::Prepend},
+    {0x00890, 0x00891, GCB::Prepend},
+    {0x008E2, 0x008E2, GCB::Prepend},
+    {0x00D4E, 0x00D4E, GCB::Prepend},
+    {0x00E33, 0x00E33, GCB::SpacingMark},
+    {0x00EB3, 0x00EB3, GCB::SpacingMark},
+    {0x01100, 0x0115F, GCB::L},
+    {0x01160, 0x011A7, GCB::V},
+    {0x011A8, 0x011FF, GCB::T},
+    {0x0203C, 0x0203C, GCB::ExtendedPictographic},
+    {0x02049, 0x02049, GCB::ExtendedPictographic},
+    {0x02122, 0x02122, GCB::ExtendedPictographic},
+    {0x02139, 0x02139, GCB::ExtendedPictographic},
+    {0x02194, 0x02199, GCB::ExtendedPictographic},
+    {0x021A9, 0x021AA, GCB::ExtendedPictographic},
+    {0x0231A, 0x0231B, GCB::ExtendedPictographic},
+    {0x02328, 0x02328, GCB::ExtendedPictographic},
+    {0x02388, 0x02388, GCB::ExtendedPictographic},
+    {0x023CF, 0x023CF, GCB::ExtendedPictographic},
+    {0x023E9, 0x023F3, GCB::ExtendedPictographic},
+    {0x023F8, 0x023FA, GCB::ExtendedPictographic},
+    {0x024C2, 0x024C2, GCB::ExtendedPictographic},
+    {0x025AA, 0x025AB, GCB::ExtendedPictographic},
+    {0x025B6, 0x025B6, GCB::ExtendedPictographic},
+    {0x025C0, 0x025C0, GCB::ExtendedPictographic},
+    {0x025FB, 0x025FE, GCB::ExtendedPictographic},
+    {0x02600, 0x02605, GCB::ExtendedPictographic},
+    {0x02607, 0x02612, GCB::ExtendedPictographic},
+    {0x02614, 0x02685, GCB::ExtendedPictographic},
+    {0x02690, 0x02705, GCB::ExtendedPictographic},
+    {0x02708, 0x02712, GCB::ExtendedPictographic},
+    {0x02714, 0x02714, GCB::ExtendedPictographic},
+    {0x02716, 0x02716, GCB::ExtendedPictographic},
+    {0x0271D, 0x0271D, GCB::ExtendedPictographic},
+    {0x02721, 0x02721, GCB::ExtendedPictographic},
+    {0x02728, 0x02728, GCB::ExtendedPictographic},
+    {0x02733, 0x02734, GCB::ExtendedPictographic},
+    {0x02744, 0x02744, GCB::ExtendedPictographic},
+    {0x02747, 0x02747, GCB::ExtendedPictographic},
+    {0x0274C, 0x0274C, GCB::ExtendedPictographic},
+    {0x0274E, 0x0274E, GCB::ExtendedPictographic},
+    {0x02753, 0x02755, GCB::ExtendedPictographic},
+    {0x02757, 0x02757, GCB::ExtendedPictographic},
+    {0x02763, 0x02767, GCB::ExtendedPictographic},
+    {0x02795, 0x02797, GCB::ExtendedPictographic},
+    {0x027A1, 0x027A1, GCB::ExtendedPictographic},
+    {0x027B0, 0x027B0, GCB::ExtendedPictographic},
+    {0x027BF, 0x027BF, GCB::ExtendedPictographic},
+    {0x02934, 0x02935, GCB::ExtendedPictographic},
+    {0x02B05, 0x02B07, GCB::ExtendedPictographic},
+    {0x02B1B, 0x02B1C, GCB::ExtendedPictographic},
+    {0x02B50, 0x02B50, GCB::ExtendedPictographic},
+    {0x02B55, 0x02B55, GCB::ExtendedPictographic},
+    {0x03030, 0x03030, GCB::ExtendedPictographic},
+    {0x0303D, 0x0303D, GCB::ExtendedPictographic},
+    {0x03297, 0x03297, GCB::ExtendedPictographic},
+    {0x03299, 0x03299, GCB::ExtendedPictographic},
+    {0x0A960, 0x0A97C, GCB::L},
+    {0x0AC00, 0x0D7A3, GCB::LV},
+    {0x0D7B0, 0x0D7C6, GCB::V},
+    {0x0D7CB, 0x0D7FB, GCB::T},
+    {0x110BD, 0x110BD, GCB::Prepend},
+    {0x110CD, 0x110CD, GCB::Prepend},
+    {0x111C2, 0x111C3, GCB::Prepend},
+    {0x1193F, 0x1193F, GCB::Prepend},
+    {0x11941, 0x11941, GCB::Prepend},
+    {0x11A3A, 0x11A3A, GCB::Prepend},
+    {0x11A84, 0x11A89, GCB::Prepend},
+    {0x11D46, 0x11D46, GCB::Prepend},
+    {0x1F000, 0x1F0FF, GCB::ExtendedPictographic},
+    {0x1F10D, 0x1F10F, GCB::ExtendedPictographic},
+    {0x1F12F, 0x1F12F, GCB::ExtendedPictographic},
+    {0x1F16C, 0x1F171, GCB::ExtendedPictographic},
+    {0x1F17E, 0x1F17F, GCB::ExtendedPictographic},
+    {0x1F18E, 0x1F18E, GCB::ExtendedPictographic},
+    {0x1F191, 0x1F19A, GCB::ExtendedPictographic},
+    {0x1F1AD, 0x1F1E5, GCB::ExtendedPictographic},
+    {0x1F201, 0x1F20F, GCB::ExtendedPictographic},
+    {0x1F21A, 0x1F21A, GCB::ExtendedPictographic},
+    {0x1F22F, 0x1F22F, GCB::ExtendedPictographic},
+    {0x1F232, 0x1F23A, GCB::ExtendedPictographic},
+    {0x1F23C, 0x1F23F, GCB::ExtendedPictographic},
+    {0x1F249, 0x1F3FA, GCB::ExtendedPictographic},
+    {0x1F400, 0x1F53D, GCB::ExtendedPictographic},
+    {0x1F546, 0x1F64F, GCB::ExtendedPictographic},
+    {0x1F680, 0x1F6FF, GCB::ExtendedPictographic},
+    {0x1F774, 0x1F77F, GCB::ExtendedPictographic},
+    {0x1F7D5, 0x1F7FF, GCB::ExtendedPictographic},
+    {0x1F80C, 0x1F80F, GCB::ExtendedPictographic},
+    {0x1F848, 0x1F84F, GCB::ExtendedPictographic},
+    {0x1F85A, 0x1F85F, GCB::ExtendedPictographic},
+    {0x1F888, 0x1F88F, GCB::ExtendedPictographic},
+    {0x1F8AE, 0x1F8FF, GCB::ExtendedPictographic},
+    {0x1F90C, 0x1F93A, GCB::ExtendedPictographic},
+    {0x1F93C, 0x1F945, GCB::ExtendedPictographic},
+    {0x1F947, 0x1FAFF, GCB::ExtendedPictographic},
+    {0x1FC00, 0x1FFFD, GCB::ExtendedPictographic},
+}};
+
+// The properties of every codepoint are stored in a two-stage table: the high
+// bits of the codepoint select a block, and the low bits an entry of the block.
+// Identical uniform blocks are shared. Each entry stores the WordBreakProperty,
+// whether the codepoint is fullwidth, and its GraphemeClass.
+constexpr uint32_t kCodepointMax = 0x10FFFF;
+constexpr int kBlockShift = 7;
+constexpr uint32_t kBlockSize = 1 << kBlockShift;
+constexpr size_t kBlockCount = (kCodepointMax + 1) >> kBlockShift;
+constexpr uint16_t kWordBreakMask = 0x1F;
+constexpr uint16_t kFullWidth = 0x20;
+constexpr int kGraphemeShift = 8;
+constexpr size_t kPropertyCount = kGraphemeClassCount << kGraphemeShift;
+
+// Whether the interval |table[index]|, the first one not ending before
+// |first|, covers either all or none of [first, last].
+template <class Table>
+constexpr bool IsUniform(const Table& table,
+                         size_t index,
+                         uint32_t first,
+                         uint32_t last) {
+  if (index == table.size()) {
+    return true;
+  }
+  if (table[index].first <= first) {  // NOLINT
+    return table[index].last >= last;  // NOLINT
+  }
+  return table[index].first > last;  // NOLINT
+}
+
+// Read the properties of increasing codepoints from the interval tables.
+struct PropertyCursor {
+  size_t word_break = 0;
+  size_t full_width = 0;
+  size_t grapheme = 0;
+
+  constexpr uint16_t Get(uint32_t ucs) {
+    while (word_break < g_word_break_intervals.size() &&
+           g_word_break_intervals[word_break].last < ucs) {  // NOLINT
+      ++word_break;
     }
-    return count;
-  }();
-
-  // Create array of extend character intervals
-  std::array<Interval, size> result{};
-  size_t index = 0;
-  for (auto interval : g_word_break_intervals) {
-    if (interval.property == WBP::Extend) {
-      result[index++] = {interval.first, interval.last};  // NOLINT
+    while (full_width < g_full_width_characters.size() &&
+           g_full_width_characters[full_width].last < ucs) {  // NOLINT
+      ++full_width;
+    }
+    while (grapheme < g_grapheme_class_intervals.size() &&
+           g_grapheme_class_intervals[grapheme].last < ucs) {  // NOLINT
+      ++grapheme;
     }
-  }
-  return result;
-}()};
 
-// Find a codepoint inside a sorted list of Interval.
-template <size_t N>
-bool Bisearch(uint32_t ucs, const std::array<Interval, N>& table) {
-  if (ucs < table.front().first || ucs > table.back().last) {  // NOLINT
-    return false;
-  }
+    WBP word_break_property = WBP::ALetter;
+    if (word_break < g_word_break_intervals.size() &&
+        g_word_break_intervals[word_break].first <= ucs) {  // NOLINT
+      word_break_property =
+          g_word_break_intervals[word_break].property;  // NOLINT
+    }
+    auto property = static_cast<uint16_t>(word_break_property);
+    if (full_width < g_full_width_characters.size() &&
+        g_full_width_characters[full_width].first <= ucs) {  // NOLINT
+      property |= kFullWidth;
+    }
 
-  int min = 0;
-  int max = N - 1;
-  while (max >= min) {
-    const int mid = (min + max) / 2;
-    if (ucs > table[mid].last) {  // NOLINT
-      min = mid + 1;
-    } else if (ucs < table[mid].first) {  // NOLINT
-      max = mid - 1;
+    GCB grapheme_class = GCB::Other;
+    if (grapheme < g_grapheme_class_intervals.size() &&
+        g_grapheme_class_intervals[grapheme].first <= ucs) {  // NOLINT
+      grapheme_class = g_grapheme_class_intervals[grapheme].property;  // NOLINT
     } else {
-      return true;
+      switch (word_break_property) {
+        case WBP::Extend:
+          grapheme_class = GCB::Extend;
+          break;
+        case WBP::ZWJ:
+          grapheme_class = GCB::ZWJ;
+          break;
+        case WBP::Regional_Indicator:
+          grapheme_class = GCB::RegionalIndicator;
+          break;
+        case WBP::CR:
+        case WBP::LF:
+        case WBP::Newline:
+        case WBP::Format:
+          grapheme_class = GCB::Control;
+          break;
+        default:
+          break;
+      }
     }
+    property |= static_cast<uint16_t>(static_cast<uint16_t>(grapheme_class)
+                                      << kGraphemeShift);
+    return property;
   }
 
-  return false;
-}
+  // Whether [first, last] share the properties of |first|. Must be called
+  // after Get(first).
+  constexpr bool Uniform(uint32_t first, uint32_t last) const {
+    return IsUniform(g_word_break_intervals, word_break, first, last) &&
+           IsUniform(g_full_width_characters, full_width, first, last) &&
+           IsUniform(g_grapheme_class_intervals, grapheme, first, last);
+  }
+};
 
-// Find a value inside a sorted list of Interval + property.
-template <class C, size_t N>
-bool Bisearch(uint32_t ucs, const std::array<C, N>& table, C* out) {
-  if (ucs < table.front().first || ucs > table.back().last) {  // NOLINT
-    return false;
+// Fill |stage1| and |stage2|, and return the number of blocks. When they are
+// null, only the blocks are counted.
+constexpr size_t BuildPropertyTables(uint16_t* stage1, uint16_t* stage2) {
+  std::array<size_t, kPropertyCount> uniform_blocks{};
+  for (auto& it : uniform_blocks) {
+    it = kBlockCount;  // None yet.
   }
 
-  int min = 0;
-  int max = N - 1;
-  while (max >= min) {
-    const int mid = (min + max) / 2;
-    if (ucs > table[mid].last) {  // NOLINT
-      min = mid + 1;
-    } else if (ucs < table[mid].first) {  // NOLINT
-      max = mid - 1;
+  size_t blocks = 0;
+  PropertyCursor cursor;
+  for (size_t block = 0; block < kBlockCount; ++block) {
+    const auto first = static_cast<uint32_t>(block << kBlockShift);
+    const uint32_t last = first + kBlockSize - 1;
+    const uint16_t property = cursor.Get(first);
+    size_t index = 0;
+    if (cursor.Uniform(first, last)) {
+      if (uniform_blocks[property] == kBlockCount) {  // NOLINT
+        uniform_blocks[property] = blocks++;         // NOLINT
+        for (uint32_t i = 0; stage2 && i < kBlockSize; ++i) {
+          stage2[uniform_blocks[property] * kBlockSize + i] =  // NOLINT
+              property;
+        }
+      }
+      index = uniform_blocks[property];  // NOLINT
     } else {
-      *out = table[mid];  // NOLINT
-      return true;
+      index = blocks++;
+      for (uint32_t i = 0; stage2 && i < kBlockSize; ++i) {
+        stage2[index * kBlockSize + i] = cursor.Get(first + i);  // NOLINT
+      }
+    }
+    if (stage1) {
+      stage1[block] = static_cast<uint16_t>(index);  // NOLINT
     }
   }
+  return blocks;
+}
 
-  return false;
+constexpr size_t kPropertyBlocks = BuildPropertyTables(nullptr, nullptr);
+static_assert(kPropertyBlocks <= 0xFFFF, "Blocks must be indexed by uint16_t");
+
+struct PropertyTables {
+  std::array<uint16_t, kBlockCount> stage1;
+  std::array<uint16_t, kPropertyBlocks * kBlockSize> stage2;
+};
+
+constexpr PropertyTables g_property_tables = []() constexpr {
+  PropertyTables tables{};
+  BuildPropertyTables(tables.stage1.data(), tables.stage2.data());
+  return tables;
+}();
+
+uint16_t CodepointProperty(uint32_t ucs) {
+  if (ucs > kCodepointMax) {
+    return static_cast<uint16_t>(WBP::ALetter);
+  }
+  const size_t block = g_property_tables.stage1[ucs >> kBlockShift];
+  return g_property_tables
+      .stage2[block * kBlockSize + (ucs & (kBlockSize - 1))];  // NOLINT
 }
 
 int codepoint_width(uint32_t ucs) {
@@ -1154,30 +1385,389 @@ int codepoint_width(uint32_t ucs) {
     return -1;
   }
 
-  if (ftxui::IsCombining(ucs)) {
+  const uint16_t property = CodepointProperty(ucs);
+  if ((property & kWordBreakMask) == static_cast<uint8_t>(WBP::Extend)) {
     return 0;
   }
 
-  if (ftxui::IsFullWidth(ucs)) {
+  if (property & kFullWidth) {
     return 2;
   }
 
   return 1;
 }
 
-enum : uint8_t {
-  SpecialMarker = 0xff
+GCB GraphemeClassOf(uint32_t ucs, uint16_t property) {
+  auto grapheme_class = static_cast<GCB>(property >> kGraphemeShift);
+  // Hangul syllables alternate between LV and LVT. Every 28th syllable, from
+  // U+AC00, has no trailing consonant.
+  if (grapheme_class == GCB::LV && (ucs - 0xAC00) % 28 != 0) {  // NOLINT
+    grapheme_class = GCB::LVT;
+  }
+  return grapheme_class;
+}
+
+// The grapheme cluster boundaries are found by a DFA, reading one codepoint at
+// a time. Its states hold what the rules of UAX #29 need to know about the
+// cluster read so far.
+enum GraphemeState : uint8_t {
+  kBreak,  // Nothing joins: start of the text, or after a control.
+  kOther,
+  kPrepend,
+  kHangulL,
+  kHangulV,                // After V or LV.
+  kHangulT,                // After T or LVT.
+  kPictographic,           // After Extended_Pictographic Extend*.
+  kPictographicZWJ,        // After Extended_Pictographic Extend* ZWJ.
+  kRegionalIndicator,      // After an odd number of regional indicators.
+  kGraphemeStateCount,
 };
 
+// Set in a transition when a new cluster starts before the codepoint.
+constexpr uint8_t kBoundary = 0x80;
+
+// The state after a codepoint starting a new cluster.
+constexpr uint8_t InitialState(GCB grapheme_class) {
+  switch (grapheme_class) {
+    case GCB::Control:
+      return kBreak;
+    case GCB::Prepend:
+      return kPrepend;
+    case GCB::L:
+      return kHangulL;
+    case GCB::V:
+    case GCB::LV:
+      return kHangulV;
+    case GCB::T:
+    case GCB::LVT:
+      return kHangulT;
+    case GCB::ExtendedPictographic:
+      return kPictographic;
+    case GCB::RegionalIndicator:
+      return kRegionalIndicator;
+    default:
+      return kOther;
+  }
+}
+
+// The rules GB4 to GB999 of UAX #29. GB3 (CR x LF) is left out, since a CR is
+// never drawn.
+constexpr uint8_t GraphemeTransition(uint8_t state, GCB grapheme_class) {
+  const uint8_t boundary = kBoundary | InitialState(grapheme_class);
+
+  // GB4, GB5:
+  if (state == kBreak || grapheme_class == GCB::Control) {
+    return boundary;
+  }
+
+  // GB9, GB9a, GB11:
+  switch (grapheme_class) {
+    case GCB::Extend:
+      return state == kPictographic ? kPictographic : kOther;
+    case GCB::ZWJ:
+      return state == kPictographic ? kPictographicZWJ : kOther;
+    case GCB::SpacingMark:
+      return kOther;
+    default:
+      break;
+  }
+
+  switch (state) {
+    case kPrepend:  // GB9b
+      return InitialState(grapheme_class);
+
+    case kHangulL:  // GB6
+      if (grapheme_class == GCB::L || grapheme_class == GCB::V ||
+          grapheme_class == GCB::LV || grapheme_class == GCB::LVT) {
+        return InitialState(grapheme_class);
+      }
+      break;
+
+    case kHangulV:  // GB7
+      if (grapheme_class == GCB::V || grapheme_class == GCB::T) {
+        return InitialState(grapheme_class);
+      }
+      break;
+
+    case kHangulT:  // GB8
+      if (grapheme_class == GCB::T) {
+        return kHangulT;
+      }
+      break;
+
+    case kPictographicZWJ:  // GB11
+      if (grapheme_class == GCB::ExtendedPictographic) {
+        return kPictographic;
+      }
+      break;
+
+    case kRegionalIndicator:  // GB12, GB13
+      if (grapheme_class == GCB::RegionalIndicator) {
+        return kOther;
+      }
+      break;
+
+    default:
+      break;
+  }
+
+  return boundary;  // GB999
+}
+
+using GraphemeDfa = std::array<std::array<uint8_t, kGraphemeClassCount>,
+                               kGraphemeStateCount>;
+
+constexpr GraphemeDfa g_grapheme_dfa = []() constexpr {
+  GraphemeDfa dfa{};
+  for (uint8_t state = 0; state < kGraphemeStateCount; ++state) {
+    for (size_t i = 0; i < kGraphemeClassCount; ++i) {
+      dfa[state][i] =  // NOLINT
+          GraphemeTransition(state, static_cast<GCB>(i));
+    }
+  }
+  return dfa;
+}();
+
+// The width of a glyph starting with |ucs|, -1 when it is not drawn.
+int GlyphStartWidth(uint32_t ucs, uint16_t property, GCB grapheme_class) {
+  if (ftxui::IsControl(ucs) || grapheme_class == GCB::Extend ||
+      grapheme_class == GCB::ZWJ || grapheme_class == GCB::SpacingMark) {
+    return -1;
+  }
+  return (property & kFullWidth) ? 2 : 1;
+}
+
+// Read the grapheme cluster starting at |start|, and return its end. |width| is
+// the number of cells it takes: 2 when it contains a fullwidth codepoint or a
+// flag, made of two regional indicators. It is -1 when the cluster is not drawn:
+// invalid UTF8, control characters, and combining characters with nothing to
+// combine with.
+size_t ReadGrapheme(std::string_view input, size_t start, int* width) {
+  uint32_t codepoint = 0;
+  size_t end = 0;
+  if (!ftxui::EatCodePoint(input, start, &end, &codepoint)) {
+    *width = -1;
+    return end;
+  }
+
+  uint16_t property = CodepointProperty(codepoint);
+  GCB grapheme_class = GraphemeClassOf(codepoint, property);
+  uint8_t state = InitialState(grapheme_class);
+  *width = GlyphStartWidth(codepoint, property, grapheme_class);
+
+  while (end < input.size()) {
+    // ASCII characters only join a preceding Prepend.
+    if (static_cast<uint8_t>(input[end]) < 0x80 && state != kPrepend) {
+      break;
+    }
+
+    size_t next = 0;
+    if (!ftxui::EatCodePoint(input, end, &next, &codepoint)) {
+      break;
+    }
+    property = CodepointProperty(codepoint);
+    grapheme_class = GraphemeClassOf(codepoint, property);
+    const uint8_t transition =
+        g_grapheme_dfa[state][static_cast<size_t>(grapheme_class)];  // NOLINT
+    if (transition & kBoundary) {
+      break;
+    }
+    state = transition;
+    end = next;
+
+    if (*width > 0 && ((property & kFullWidth) ||
+                       grapheme_class == GCB::RegionalIndicator)) {
+      *width = 2;
+    }
+  }
+  return end;
+}
+
+// Call |on_glyphs(width, count)| for the successive glyphs of |input|, in a
+// single pass. |count| consecutive glyphs have the same |width|, -1 when they
+// are not drawn. This is ReadGrapheme() without reading codepoints twice.
+template <typename Callback>
+void ForEachGlyphWidth(std::string_view input, Callback on_glyphs) {
+  int width = -1;  // Of the current glyph. None yet.
+  uint8_t state = kBreak;
+  size_t start = 0;
+  while (start < input.size()) {
+    // ASCII characters only join a preceding Prepend.
+    if (state != kPrepend) {
+      const size_t ascii_end = ftxui::AsciiRunEnd(input, start);
+      if (ascii_end != start) {
+        on_glyphs(width, 1);
+        on_glyphs(1, ascii_end - start - 1);
+        width = 1;
+        state = kOther;
+        start = ascii_end;
+        continue;
+      }
+    }
+
+    // Invalid UTF8 is a glyph of its own, not drawn.
+    uint32_t codepoint = 0;
+    if (!ftxui::EatCodePoint(input, start, &start, &codepoint)) {
+      on_glyphs(width, 1);
+      width = -1;
+      state = kBreak;
+      continue;
+    }
+
+    const uint16_t property = CodepointProperty(codepoint);
+    const GCB grapheme_class = GraphemeClassOf(codepoint, property);
+
+    // Most codepoints start a glyph, and only join a preceding Prepend.
+    const uint8_t transition =
+        (grapheme_class == GCB::Other && state != kPrepend)
+            ? (kBoundary | kOther)
+            : g_grapheme_dfa[state][static_cast<size_t>(grapheme_class)];  // NOLINT
+    if (transition & kBoundary) {
+      on_glyphs(width, 1);
+      width = GlyphStartWidth(codepoint, property, grapheme_class);
+    } else if (width > 0 && ((property & kFullWidth) ||
+                             grapheme_class == GCB::RegionalIndicator)) {
+      width = 2;
+    }
+    state = transition & ~kBoundary;
+  }
+  on_glyphs(width, 1);
+}
+
+// Read the codepoint ending right before |position|. Return false when it is
+// invalid.
+bool PreviousCodepoint(std::string_view input,
+                       size_t position,
+                       size_t* start,
+                       GCB* grapheme_class) {
+  // A codepoint takes at most 4 bytes.
+  size_t previous = position - 1;
+  while (previous > 0 && position - previous < 4 &&
+         (input[previous] & 0b1100'0000) == 0b1000'0000) {
+    previous--;
+  }
+  uint32_t codepoint = 0;
+  size_t end = 0;
+  if (!ftxui::EatCodePoint(input, previous, &end, &codepoint) ||
+      end != position) {
+    return false;
+  }
+  *start = previous;
+  *grapheme_class = GraphemeClassOf(codepoint, CodepointProperty(codepoint));
+  return true;
+}
+
+// Whether a glyph is known to start at |position|, reading only the codepoints
+// just before. |limit| bounds how far back a run of regional indicators is
+// counted.
+bool IsGlyphBoundary(std::string_view input, size_t position, size_t limit) {
+  uint32_t codepoint = 0;
+  size_t end = 0;
+  if (position <= limit ||
+      !ftxui::EatCodePoint(input, position, &end, &codepoint)) {
+    return true;
+  }
+  const GCB grapheme_class =
+      GraphemeClassOf(codepoint, CodepointProperty(codepoint));
+  switch (grapheme_class) {
+    case GCB::Control:  // GB5
+      return true;
+    case GCB::Extend:  // GB9, GB9a
+    case GCB::ZWJ:
+    case GCB::SpacingMark:
+      return false;
+    default:
+      break;
+  }
+
+  size_t previous = 0;
+  GCB previous_class = GCB::Other;
+  if (!PreviousCodepoint(input, position, &previous, &previous_class)) {
+    return true;
+  }
+  if (previous_class == GCB::Prepend) {
+    return false;  // GB9b
+  }
+
+  switch (grapheme_class) {
+    case GCB::ExtendedPictographic:  // GB11
+      return previous_class != GCB::ZWJ;
+
+    case GCB::L:  // GB6
+      return previous_class != GCB::L;
+
+    case GCB::V:  // GB6, GB7
+      return previous_class != GCB::L && previous_class != GCB::V &&
+             previous_class != GCB::LV;
+
+    case GCB::T:  // GB7, GB8
+      return previous_class != GCB::V && previous_class != GCB::T &&
+             previous_class != GCB::LV && previous_class != GCB::LVT;
+
+    case GCB::LV:  // GB6
+    case GCB::LVT:
+      return previous_class != GCB::L;
+
+    case GCB::RegionalIndicator: {  // GB12, GB13
+      // Flags pair the regional indicators from the start of their run. A run
+      // reaching |limit| is assumed to start there. They are all encoded as
+      // F0 9F 87 A6..BF.
+      auto is_regional_indicator = [&](size_t at) {
+        return static_cast<uint8_t>(input[at]) == 0xF0 &&
+               static_cast<uint8_t>(input[at + 1]) == 0x9F &&
+               static_cast<uint8_t>(input[at + 2]) == 0x87 &&
+               static_cast<uint8_t>(input[at + 3]) >= 0xA6;
+      };
+      if (previous_class != GCB::RegionalIndicator) {
+        return true;
+      }
+      size_t count = 1;
+      while (previous >= limit + 4 && is_regional_indicator(previous - 4)) {
+        previous -= 4;
+        ++count;
+      }
+      return count % 2 == 0;
+    }
+
+    default:  // GB999
+      return true;
+  }
+}
+
 }  // namespace
 
 namespace ftxui {
 
+size_t AsciiRunEnd(std::string_view input, size_t start) {
+  const size_t size = input.size();
+#if defined(__SSE2__)
+  // Compare 16 bytes at once. As signed integers, the non ASCII bytes are
+  // negative.
+  const __m128i lower = _mm_set1_epi8(' ' - 1);
+  const __m128i upper = _mm_set1_epi8('~' + 1);
+  while (start + 16 <= size) {
+    const __m128i bytes = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(input.data() + start));  // NOLINT
+    const __m128i printable = _mm_and_si128(_mm_cmpgt_epi8(bytes, lower),
+                                            _mm_cmplt_epi8(bytes, upper));
+    const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(printable));
+    if (mask != 0xFFFF) {
+      return start + static_cast<size_t>(__builtin_ctz(~mask));
+    }
+    start += 16;
+  }
+#endif
+  while (start < size && input[start] >= ' ' && input[start] <= '~') {
+    ++start;
+  }
+  return start;
+}
+
 // From UTF8 encoded string |input|, eat in between 1 and 4 byte representing
 // one codepoint. Put the codepoint into |ucs|. Start at |start| and update
 // |end| to represent the beginning of the next byte to eat for consecutive
 // executions.
-bool EatCodePoint(const std::string& input,
+bool EatCodePoint(std::string_view input,
                   size_t start,
                   size_t* end,
                   uint32_t* ucs) {
@@ -1194,20 +1784,6 @@ bool EatCodePoint(const std::string& input,
     return true;
   }
 
-  // Color
-  if (C0 == SpecialMarkers::ColorSet) {
-    *ucs = SpecialMarker;
-    *end = start + sizeof(Color) + 1;
-    return true;
-  }
-
-  // Default color
-  if (C0 == SpecialMarkers::ColorReset) {
-    *ucs = SpecialMarker;
-    *end = start + 1;
-    return true;
-  }
-
   // 2 byte string.
   if ((C0 & 0b1110'0000) == 0b1100'0000 &&  // NOLINT
       start + 1 < input.size()) {
@@ -1280,18 +1856,6 @@ bool EatCodePoint(const std::wstring& input,
   // On windows, wstring uses the UTF16 encoding:
   int32_t C0 = input[start];  // NOLINT
 
-  if (C0 == SpecialMarkers::ColorSet) {
-    *ucs = SpecialMarker;
-    *end = start + sizeof(Color) + 1;
-    return true;
-  }
-
-  if (C0 == SpecialMarkers::ColorReset) {
-    *ucs = SpecialMarker;
-    *end = start + 1;
-    return true;
-  }
-
   // 1 word size:
   if (C0 < 0xd800 || C0 >= 0xdc00) {  // NOLINT
     *ucs = C0;
@@ -1312,14 +1876,11 @@ bool EatCodePoint(const std::wstring& input,
 }
 
 bool IsCombining(uint32_t ucs) {
-  return Bisearch(ucs, g_extend_characters);
+  return CodepointToWordBreakProperty(ucs) == WBP::Extend;
 }
 
 bool IsFullWidth(uint32_t ucs) {
-  if (ucs < 0x0300)  // Quick path: // NOLINT
-    return false;
-
-  return Bisearch(ucs, g_full_width_characters);
+  return CodepointProperty(ucs) & kFullWidth;
 }
 
 bool IsControl(uint32_t ucs) {
@@ -1337,9 +1898,7 @@ bool IsControl(uint32_t ucs) {
 }
 
 WordBreakProperty CodepointToWordBreakProperty(uint32_t codepoint) {
-  WordBreakPropertyInterval interval = {0, 0, WBP::ALetter};
-  std::ignore = Bisearch(codepoint, g_word_break_intervals, &interval);
-  return interval.property;
+  return static_cast<WBP>(CodepointProperty(codepoint) & kWordBreakMask);
 }
 
 int wchar_width(wchar_t ucs) {
@@ -1360,133 +1919,122 @@ int wstring_width(const std::wstring& text) {
 }
 
 int string_width(const std::string& input) {
+  return StringWidth(input);
+}
+
+int StringWidth(std::string_view input) {
+  // Glyphs not drawn have a negative width, and are ignored.
   int width = 0;
-  size_t start = 0;
-  while (start < input.size()) {
-    uint32_t codepoint = 0;
-    if (!EatCodePoint(input, start, &start, &codepoint)) {
-      continue;
+  ForEachGlyphWidth(input, [&](int glyph_width, size_t count) {
+    if (glyph_width > 0) {
+      width += glyph_width * static_cast<int>(count);
     }
+  });
+  return width;
+}
 
-    if (codepoint == SpecialMarker) {
-      continue;
-    }
+GlyphIterator::GlyphIterator(std::string_view input, size_t start)
+    : input_(input) {
+  Read(start);
+}
 
-    if (IsControl(codepoint)) {
-      continue;
-    }
+GlyphIterator& GlyphIterator::operator++() {
+  Read(start_ + glyph_.value.size());
+  return *this;
+}
 
-    if (IsCombining(codepoint)) {
-      continue;
+GlyphIterator GlyphIterator::operator++(int) {
+  GlyphIterator previous = *this;
+  ++*this;
+  return previous;
+}
+
+// Find the first glyph starting at or after |start|.
+void GlyphIterator::Read(size_t start) {
+  const size_t size = input_.size();
+  while (start < size) {
+    // Printable ASCII characters are by far the most common. Followed by
+    // another ASCII character, they are a glyph on their own.
+    const auto C0 = static_cast<uint8_t>(input_[start]);
+    if (C0 >= ' ' && C0 <= '~' &&
+        (start + 1 == size ||
+         static_cast<uint8_t>(input_[start + 1]) < 0x80)) {  // NOLINT
+      start_ = start;
+      glyph_ = {input_.substr(start, 1), 1};
+      return;
     }
 
-    if (IsFullWidth(codepoint)) {
-      width += 2;
+    int width = 0;
+    const size_t end = ReadGrapheme(input_, start, &width);
+    if (width < 0) {
+      start = end;
       continue;
     }
 
-    width += 1;
+    start_ = start;
+    glyph_ = {input_.substr(start, end - start), width};
+    return;
   }
-  return width;
+  start_ = size;
+  glyph_ = {};
 }
 
 std::vector<std::string> Utf8ToGlyphs(const std::string& input) {
   std::vector<std::string> out;
   out.reserve(input.size());
-  size_t start = 0;
-  size_t end = 0;
-  while (start < input.size()) {
-    uint32_t codepoint = 0;
-    if (!EatCodePoint(input, start, &end, &codepoint)) {
-      start = end;
-      continue;
-    }
-
-    const std::string append = input.substr(start, end - start);
-    start = end;
-
-    // Color
-    if (codepoint == SpecialMarker) {
-      out.emplace_back(append);
-      continue;
-    }
-
-    // Ignore control characters.
-    if (IsControl(codepoint)) {
-      continue;
-    }
-
-    // Combining characters are put with the previous glyph they are modifying.
-    if (IsCombining(codepoint)) {
-      if (!out.empty()) {
-        out.back() += append;
-      }
-      continue;
-    }
+  for (const Glyph& glyph : Glyphs(input)) {
+    out.emplace_back(glyph.value);
 
     // Fullwidth characters take two cells. The second is made of the empty
     // string to reserve the space the first is taking.
-    if (IsFullWidth(codepoint)) {
-      out.push_back(append);
+    if (glyph.width == 2) {
       out.emplace_back("");
-      continue;
     }
-
-    // Normal characters:
-    out.push_back(append);
   }
   return out;
 }
 
 size_t GlyphPrevious(const std::string& input, size_t start) {
-  while (true) {
-    if (start == 0) {
-      return 0;
+  // Glyphs can only be delimited reading forward. Step back to a known glyph
+  // boundary, and read the glyphs from there up to |start|.
+  //
+  // The search is bounded, so that stepping back stays cheap on any input. A
+  // glyph longer than kMaxGlyphLookBehind bytes, like a pathological sequence
+  // of combining characters, is split.
+  constexpr size_t kMaxGlyphLookBehind = 1024;
+  while (start > 0) {
+    const size_t limit =
+        start > kMaxGlyphLookBehind ? start - kMaxGlyphLookBehind : 0;
+    size_t boundary = start - 1;
+    while (boundary > limit &&
+           ((input[boundary] & 0b1100'0000) == 0b1000'0000 ||
+            !IsGlyphBoundary(input, boundary, limit))) {
+      boundary--;
     }
-    start--;
-
-    // Skip the UTF8 continuation bytes.
-    if ((input[start] & 0b1100'0000) == 0b1000'0000) {
-      continue;
+    while (boundary > 0 && (input[boundary] & 0b1100'0000) == 0b1000'0000) {
+      boundary--;
     }
 
-    uint32_t codepoint = 0;
-    size_t end = 0;
-    const bool eaten = EatCodePoint(input, start, &end, &codepoint);
-
-    // Ignore invalid, control characters and combining characters.
-    if (!eaten || IsControl(codepoint) || IsCombining(codepoint)) {
-      continue;
+    size_t previous = start;
+    for (GlyphIterator it(input, boundary); it.position() < start; ++it) {
+      previous = it.position();
+    }
+    if (previous < start) {
+      return previous;
     }
 
-    return start;
+    // Only invalid or control characters. Look further back.
+    start = boundary;
   }
+  return 0;
 }
 
 size_t GlyphNext(const std::string& input, size_t start) {
-  bool glyph_found = false;
-  while (start < input.size()) {
-    size_t end = 0;
-    uint32_t codepoint = 0;
-    const bool eaten = EatCodePoint(input, start, &end, &codepoint);
-
-    // Ignore invalid, control characters and combining characters.
-    if (!eaten || IsControl(codepoint) || IsCombining(codepoint)) {
-      start = end;
-      continue;
-    }
-
-    // We eat the beginning of the next glyph. If we are eating the one
-    // requested, return its start position immediately.
-    if (glyph_found) {
-      return static_cast<int>(start);
-    }
-
-    // Otherwise, skip this glyph and iterate:
-    glyph_found = true;
-    start = end;
+  GlyphIterator it(input, start);
+  if (it.position() < input.size()) {
+    ++it;
   }
-  return static_cast<int>(input.size());
+  return it.position();
 }
 
 size_t GlyphIterate(const std::string& input, int glyph_offset, size_t start) {
@@ -1507,68 +2055,29 @@ std::vector<int> CellToGlyphIndex(const std::string& input) {
   int x = -1;
   std::vector<int> out;
   out.reserve(input.size());
-  size_t start = 0;
-  size_t end = 0;
-  while (start < input.size()) {
-    uint32_t codepoint = 0;
-    const bool eaten = EatCodePoint(input, start, &end, &codepoint);
-    start = end;
-
-    // Ignore invalid / control characters.
-    if (!eaten || IsControl(codepoint)) {
-      continue;
+  ForEachGlyphWidth(input, [&](int width, size_t count) {
+    // Ignore the glyphs not drawn. Fullwidth glyphs take two cells.
+    if (width < 0) {
+      return;
     }
-
-    // Combining characters are put with the previous glyph they are modifying.
-    if (IsCombining(codepoint)) {
-      if (x == -1) {
-        ++x;
+    for (size_t i = 0; i < count; ++i) {
+      ++x;
+      for (int cell = 0; cell < width; ++cell) {
         out.push_back(x);
       }
-      continue;
-    }
-
-    // Fullwidth characters take two cells. The second is made of the empty
-    // string to reserve the space the first is taking.
-    if (IsFullWidth(codepoint)) {
-      ++x;
-      out.push_back(x);
-      out.push_back(x);
-      continue;
     }
-
-    // Normal characters:
-    ++x;
-    out.push_back(x);
-  }
+  });
   return out;
 }
 
 int GlyphCount(const std::string& input) {
+  // Ignore the glyphs not drawn.
   int size = 0;
-  size_t start = 0;
-  size_t end = 0;
-  while (start < input.size()) {
-    uint32_t codepoint = 0;
-    const bool eaten = EatCodePoint(input, start, &end, &codepoint);
-    start = end;
-
-    // Ignore invalid characters:
-    if (!eaten || IsControl(codepoint)) {
-      continue;
+  ForEachGlyphWidth(input, [&](int width, size_t count) {
+    if (width >= 0) {
+      size += static_cast<int>(count);
     }
-
-    // Ignore combining characters, except when they don't have a preceding to
-    // combine with.
-    if (IsCombining(codepoint)) {
-      if (size == 0) {
-        size++;
-      }
-      continue;
-    }
-
-    size++;
-  }
+  });
   return size;
 }
 
@@ -1576,29 +2085,13 @@ std::vector<WordBreakProperty> Utf8ToWordBreakProperty(
     const std::string& input) {
   std::vector<WordBreakProperty> out;
   out.reserve(input.size());
-  size_t start = 0;
-  size_t end = 0;
-  while (start < input.size()) {
-    uint32_t codepoint = 0;
-    if (!EatCodePoint(input, start, &end, &codepoint)) {
-      start = end;
-      continue;
-    }
-    start = end;
-
-    // Ignore control characters.
-    if (IsControl(codepoint)) {
-      continue;
-    }
 
-    // Ignore combining characters.
-    if (IsCombining(codepoint)) {
-      continue;
-    }
-
-    WordBreakPropertyInterval interval = {0, 0, WBP::ALetter};
-    std::ignore = Bisearch(codepoint, g_word_break_intervals, &interval);
-    out.push_back(interval.property);
+  // The property of a glyph is the one of its first codepoint.
+  for (const Glyph& glyph : Glyphs(input)) {
+    uint32_t codepoint = 0;
+    size_t end = 0;
+    EatCodePoint(glyph.value, 0, &end, &codepoint);
+    out.push_back(CodepointToWordBreakProperty(codepoint));
   }
   return out;
 }
@@ -1708,10 +2201,6 @@ std::wstring to_wstring(const std::string& s) {
   return out;
 }
 
-const Color* GlyphToColor(const std::string& glyph) {
-  return reinterpret_cast<const Color*>(glyph.c_str() + 1);
-}
-
 }  // namespace ftxui
 
 // vim: set expandtab tabstop=2 shiftwidth=2 softtabstop=2 :
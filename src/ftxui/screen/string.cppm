@@ -15,6 +15,10 @@ export namespace ftxui {
     using ftxui::to_string;
     using ftxui::to_wstring;
     using ftxui::string_width;
+    using ftxui::Glyph;
+    using ftxui::GlyphIterator;
+    using ftxui::GlyphRange;
+    using ftxui::Glyphs;
     using ftxui::Utf8ToGlyphs;
     using ftxui::CellToGlyphIndex;
 }
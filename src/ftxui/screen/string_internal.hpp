@@ -6,11 +6,12 @@
 
 #include <cstdint>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace ftxui {
 
-bool EatCodePoint(const std::string& input,
+bool EatCodePoint(std::string_view input,
                   size_t start,
                   size_t* end,
                   uint32_t* ucs);
@@ -19,10 +20,18 @@ bool EatCodePoint(const std::wstring& input,
                   size_t* end,
                   uint32_t* ucs);
 
+// Returns the end of the run of printable ASCII characters in |input|
+// starting at |start|. Each of them is a glyph of width 1, which only the last
+// one may share with the following combining characters.
+size_t AsciiRunEnd(std::string_view input, size_t start);
+
 bool IsCombining(uint32_t ucs);
 bool IsFullWidth(uint32_t ucs);
 bool IsControl(uint32_t ucs);
 
+// Same as string_width(), without requiring a std::string.
+int StringWidth(std::string_view input);
+
 size_t GlyphPrevious(const std::string& input, size_t start);
 size_t GlyphNext(const std::string& input, size_t start);
 
@@ -3,7 +3,9 @@
 // the LICENSE file.
 #include "ftxui/screen/string.hpp"
 #include <gtest/gtest.h>
+#include <chrono>  // for steady_clock, milliseconds
 #include <string>  // for allocator, string
+#include <vector>  // for vector
 #include "ftxui/screen/string_internal.hpp"
 
 namespace ftxui {
@@ -48,6 +50,124 @@ TEST(StringTest, Utf8ToGlyphs) {
   EXPECT_EQ(Utf8ToGlyphs("a\1a"), T({"a", "a"}));
 }
 
+TEST(StringTest, Glyphs) {
+  std::vector<std::string_view> values;
+  std::vector<int> widths;
+  for (const Glyph& glyph : Glyphs("a测\1a\u0304\n")) {
+    values.push_back(glyph.value);
+    widths.push_back(glyph.width);
+  }
+  EXPECT_EQ(values, std::vector<std::string_view>({"a", "测", "a\u0304", "\n"}));
+  EXPECT_EQ(widths, std::vector<int>({1, 2, 1, 1}));
+
+  // Empty, or only made of control characters:
+  EXPECT_EQ(Glyphs("").begin(), Glyphs("").end());
+  EXPECT_EQ(Glyphs("\1\2").begin(), Glyphs("\1\2").end());
+
+  // Positions in the input:
+  const std::string input = "测a";
+  auto it = Glyphs(input).begin();
+  EXPECT_EQ(it.position(), 0u);
+  ++it;
+  EXPECT_EQ(it.position(), 3u);
+  EXPECT_EQ(it->value, "a");
+  ++it;
+  EXPECT_EQ(it, Glyphs(input).end());
+}
+
+TEST(StringTest, GraphemeClusters) {
+  auto split = [](std::string_view input) {
+    std::vector<std::string_view> values;
+    for (const Glyph& glyph : Glyphs(input)) {
+      values.push_back(glyph.value);
+    }
+    return values;
+  };
+  using V = std::vector<std::string_view>;
+
+  // Emoji ZWJ sequences, and modifiers:
+  const std::string family = "\U0001F468\u200D\U0001F469\u200D\U0001F467";
+  const std::string thumb = "\U0001F44D\U0001F3FD";
+  EXPECT_EQ(split(family + thumb + "a"), V({family, thumb, "a"}));
+  EXPECT_EQ(string_width(family + thumb), 4);
+
+  // A ZWJ joins pictographs only:
+  EXPECT_EQ(split("a\u200Db"), V({"a\u200D", "b"}));
+
+  // Flags are pairs of regional indicators:
+  const std::string fr = "\U0001F1EB\U0001F1F7";
+  const std::string de = "\U0001F1E9\U0001F1EA";
+  EXPECT_EQ(split(fr + de + "\U0001F1EB"), V({fr, de, "\U0001F1EB"}));
+  EXPECT_EQ(string_width(fr), 2);
+
+  // Hangul syllables, from conjoining jamos or precomposed (LV and LVT):
+  const std::string jamos = "\u1100\u1161\u11A8";
+  EXPECT_EQ(split(jamos + "\uAC00\u11A8\uAC01\u11A8"),
+            V({jamos, "\uAC00\u11A8", "\uAC01\u11A8"}));
+  EXPECT_EQ(string_width(jamos), 2);
+
+  // Prepend characters join the following one:
+  EXPECT_EQ(split("\u0600a b"), V({"\u0600a", " ", "b"}));
+
+  // Controls are never joined, nor drawn:
+  EXPECT_EQ(split("a\r\n\u0301b"), V({"a", "\n", "b"}));
+
+  // The other functions agree:
+  const std::string input = "x" + family + fr + jamos + "\u0600a";
+  EXPECT_EQ(GlyphCount(input), 5);
+  EXPECT_EQ(CellToGlyphIndex(input),
+            std::vector<int>({0, 1, 1, 2, 2, 3, 3, 4}));
+  EXPECT_EQ(Utf8ToGlyphs(input).size(), 8u);
+  std::vector<size_t> forward = {0};
+  while (forward.back() < input.size()) {
+    forward.push_back(GlyphNext(input, forward.back()));
+  }
+  std::vector<size_t> backward = {input.size()};
+  while (backward.back() > 0) {
+    backward.push_back(GlyphPrevious(input, backward.back()));
+  }
+  EXPECT_EQ(forward, std::vector<size_t>(backward.rbegin(), backward.rend()));
+  EXPECT_EQ(forward.size(), 6u);
+}
+
+TEST(StringTest, GlyphPreviousIsLinear) {
+  // Stepping back a glyph only reads the codepoints right before it, not the
+  // whole text. Walking back through these texts used to take seconds.
+  const std::vector<std::string> glyphs = {
+      "\U0001F600",                                  // Emoji.
+      "\U0001F44D\U0001F3FD",                       // Skin tone modifier.
+      "\U0001F468\u200D\U0001F469\u200D\U0001F467",  // ZWJ sequence.
+      "\U0001F1EB\U0001F1F7",                       // Flag.
+      "\uD55C",                                      // Hangul LVT syllable.
+      "\uAC00\u11A8",                               // Hangul LV T.
+      "\u1100\u1161\u11A8",                        // Hangul jamos.
+      "e\u0301",                                     // Combining accent.
+  };
+  for (const std::string& glyph : glyphs) {
+    std::string input;
+    const size_t count = 16000;
+    for (size_t i = 0; i < count; ++i) {
+      input += glyph;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    size_t position = input.size();
+    size_t steps = 0;
+    while (position > 0) {
+      const size_t previous = GlyphPrevious(input, position);
+      EXPECT_EQ(previous, position - glyph.size()) << glyph;
+      if (previous != position - glyph.size()) {
+        break;
+      }
+      position = previous;
+      steps++;
+    }
+    const auto duration = std::chrono::steady_clock::now() - start;
+    EXPECT_EQ(steps, count) << glyph;
+    EXPECT_LT(duration, std::chrono::milliseconds(500)) << glyph;
+  }
+}
+
 TEST(StringTest, GlyphCount) {
   // Basic:
   EXPECT_EQ(GlyphCount(""), 0);
@@ -126,6 +246,29 @@ TEST(StringTest, CellToGlyphIndex) {
   EXPECT_EQ(combining[2], 2);
 }
 
+TEST(StringTest, AsciiRun) {
+  // Long enough to cross several blocks, with the non ASCII characters at
+  // every position.
+  const std::string ascii = "The quick brown fox jumps over the lazy dog";
+  EXPECT_EQ(AsciiRunEnd(ascii, 0), ascii.size());
+  EXPECT_EQ(AsciiRunEnd(ascii, 5), ascii.size());
+  for (size_t i = 0; i <= ascii.size(); ++i) {
+    for (const std::string inserted : {"测", "á", "\1", "\x7F"}) {
+      std::string input = ascii;
+      input.insert(i, inserted);
+      EXPECT_EQ(AsciiRunEnd(input, 0), i + (inserted[0] == 'a'));
+
+      const int inserted_width = string_width(inserted);
+      EXPECT_EQ(string_width(input), int(ascii.size()) + inserted_width);
+      EXPECT_EQ(GlyphCount(input), int(ascii.size()) + GlyphCount(inserted));
+      EXPECT_EQ(Utf8ToGlyphs(input).size(),
+                ascii.size() + Utf8ToGlyphs(inserted).size());
+      EXPECT_EQ(CellToGlyphIndex(input).size(),
+                ascii.size() + CellToGlyphIndex(inserted).size());
+    }
+  }
+}
+
 TEST(StringTest, Utf8ToWordBreakProperty) {
   using T = std::vector<WordBreakProperty>;
   using P = WordBreakProperty;
@@ -142,6 +285,25 @@ TEST(StringTest, Utf8ToWordBreakProperty) {
   EXPECT_EQ(Utf8ToWordBreakProperty("\n"), T({P::LF}));
 }
 
+TEST(StringTest, CodepointProperties) {
+  EXPECT_TRUE(IsCombining(0x0301));
+  EXPECT_TRUE(IsCombining(0xE0100));
+  EXPECT_FALSE(IsCombining('a'));
+  EXPECT_TRUE(IsFullWidth(0x4E00));
+  EXPECT_TRUE(IsFullWidth(0x3FFFD));
+  EXPECT_FALSE(IsFullWidth('a'));
+  EXPECT_FALSE(IsFullWidth(0x10FFFF));
+  EXPECT_EQ(CodepointToWordBreakProperty('a'), WordBreakProperty::ALetter);
+  EXPECT_EQ(CodepointToWordBreakProperty('0'), WordBreakProperty::Numeric);
+  EXPECT_EQ(CodepointToWordBreakProperty(0x1F1E6),
+            WordBreakProperty::Regional_Indicator);
+  EXPECT_EQ(CodepointToWordBreakProperty(0x200D), WordBreakProperty::ZWJ);
+
+  // Out of the Unicode range:
+  EXPECT_FALSE(IsCombining(0x110000));
+  EXPECT_FALSE(IsFullWidth(0xFFFFFFFF));
+}
+
 TEST(StringTest, to_string) {
   EXPECT_EQ(to_string(L"hello"), "hello");
   EXPECT_EQ(to_string(L"€"), "€");
@@ -4,6 +4,8 @@
 #ifndef FTXUI_SCREEN_UTIL_HPP
 #define FTXUI_SCREEN_UTIL_HPP
 
+#include <string>  // for string
+
 namespace ftxui::util {
 
 // Similar to std::clamp, but allow hi to be lower than lo.
@@ -12,6 +14,26 @@ constexpr const T& clamp(const T& v, const T& lo, const T& hi) {
   return v < lo ? lo : hi < v ? hi : v;
 }
 
+// Append the decimal representation of |value| to |out|, without allocating a
+// temporary string. The output matches std::to_string(value).
+inline void AppendNumber(std::string& out, int value) {
+  // Work on the magnitude as an unsigned value, so that INT_MIN is handled.
+  unsigned int magnitude = static_cast<unsigned int>(value);
+  if (value < 0) {
+    out.push_back('-');
+    magnitude = 0U - magnitude;
+  }
+  char digits[10];  // NOLINT
+  int size = 0;
+  do {
+    digits[size++] = static_cast<char>('0' + magnitude % 10U);  // NOLINT
+    magnitude /= 10U;                                           // NOLINT
+  } while (magnitude != 0U);
+  while (size != 0) {
+    out.push_back(digits[--size]);  // NOLINT
+  }
+}
+
 }  // namespace ftxui::util
 
 #endif /* end of include guard: FTXUI_SCREEN_UTIL_HPP */